@@ -41,9 +41,14 @@ public class AssetActionsManager : ModuleRules
 			new string[]
 			{
 				"CoreUObject",
+				"DeveloperSettings",
+				"DeveloperToolSettings",
 				"Engine",
+				"Json",
+				"Projects",
 				"Slate",
 				"SlateCore",
+				"SourceControl",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
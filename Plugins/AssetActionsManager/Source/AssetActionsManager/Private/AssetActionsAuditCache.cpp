@@ -0,0 +1,453 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsAuditCache.h"
+#include "AssetActionsCatalog.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FAssetActionsAuditCache::FAssetActionsAuditCache() = default;
+
+FAssetActionsAuditCache::~FAssetActionsAuditCache()
+{
+	Unload();
+}
+
+#pragma region Format
+
+FAssetActionsAuditCache::FLayout FAssetActionsAuditCache::GetLayout(const FHeader& Header)
+/*
+	Records hold 64 bit timestamps, so every table before the string blob keeps 8 byte alignment
+*/
+{
+	static_assert(sizeof(FHeader) % 8 == 0 && sizeof(FRecord) % 8 == 0 && sizeof(FStamp) % 8 == 0, 
+		"Tables before the string blob must stay 8 byte aligned");
+
+	FLayout Layout;
+	Layout.StringEntries = sizeof(FHeader);
+	Layout.Records = Layout.StringEntries + static_cast<int64>(Header.NumStrings) * sizeof(FStringEntry);
+	Layout.Stamps = Layout.Records + static_cast<int64>(Header.NumRecords) * sizeof(FRecord);
+	Layout.Referencers = Layout.Stamps + static_cast<int64>(Header.NumStamps) * sizeof(FStamp);
+	Layout.StringData = Align(Layout.Referencers + static_cast<int64>(Header.NumReferencers) * sizeof(int32), 8);
+	Layout.Total = Layout.StringData + Header.StringDataSize;
+
+	return Layout;
+}
+
+uint64 FAssetActionsAuditCache::GetFoldersKey(const TArray<FString>& FolderPaths)
+{
+	TArray<FString> SortedFolderPaths = FolderPaths;
+	SortedFolderPaths.Sort();
+
+	const FString JoinedFolderPaths = FString::Join(SortedFolderPaths, TEXT("|")).ToLower();
+
+	return CityHash64(reinterpret_cast<const char*>(*JoinedFolderPaths), JoinedFolderPaths.Len() * sizeof(TCHAR));
+}
+
+FString FAssetActionsAuditCache::GetFilename(const TArray<FString>& FolderPaths)
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetActionsManager") / FString::Printf(TEXT("AuditCache-%016llx.bin"), GetFoldersKey(FolderPaths));
+}
+
+bool FAssetActionsAuditCache::IsValidCache(uint64 FoldersKey) const
+{
+	if (DataSize < static_cast<int64>(sizeof(FHeader))) return false;
+
+	const FHeader& Header = GetHeader();
+
+	if (Header.Magic != CacheMagic || Header.Version != CacheVersion || Header.FoldersKey != FoldersKey) return false;
+
+	if (Header.NumStrings < 0 || Header.NumRecords < 0 || Header.NumStamps < 0 || Header.NumReferencers < 0 || Header.StringDataSize < 0) return false;
+
+	if (GetLayout(Header).Total != DataSize) return false;
+
+	const FStringEntry* StringEntries = GetStringEntries();
+
+	for (int32 StringIndex = 0; StringIndex < Header.NumStrings; ++StringIndex)
+	{
+		if (static_cast<int64>(StringEntries[StringIndex].Offset) + StringEntries[StringIndex].Length > Header.StringDataSize) return false;
+	}
+
+	auto IsValidString = [&Header](int32 StringIndex) { return StringIndex >= 0 && StringIndex < Header.NumStrings; };
+
+	const FRecord* Records = GetRecords();
+
+	for (int32 RecordIndex = 0; RecordIndex < Header.NumRecords; ++RecordIndex)
+	{
+		const FRecord& Record = Records[RecordIndex];
+
+		if (!IsValidString(Record.PackageName) || !IsValidString(Record.PackagePath) || !IsValidString(Record.AssetName) ||
+			!IsValidString(Record.ClassPackageName) || !IsValidString(Record.ClassAssetName))
+		{
+			return false;
+		}
+
+		if (Record.FirstReferencer != INDEX_NONE && (Record.FirstReferencer < 0 || Record.NumReferencers < 0 ||
+			static_cast<int64>(Record.FirstReferencer) + Record.NumReferencers > Header.NumReferencers))
+		{
+			return false;
+		}
+	}
+
+	const FStamp* Stamps = GetStamps();
+
+	for (int32 StampIndex = 0; StampIndex < Header.NumStamps; ++StampIndex)
+	{
+		if (!IsValidString(Stamps[StampIndex].PackageName)) return false;
+	}
+
+	const int32* Referencers = GetReferencers();
+
+	for (int32 ReferencerIndex = 0; ReferencerIndex < Header.NumReferencers; ++ReferencerIndex)
+	{
+		if (!IsValidString(Referencers[ReferencerIndex])) return false;
+	}
+
+	return true;
+}
+
+#pragma endregion
+
+#pragma region Saving
+
+bool FAssetActionsAuditCache::Save(const TArray<FString>& FolderPaths, const TArray<TSharedPtr<FAssetData>>& Assets,
+	const TMap<FName, FDateTime>& PackageTimestamps, const TMap<FName, TArray<FName>>& Referencers)
+/*
+	Build every table in memory, then write the file in one call. Names shared by many records, such as folders
+	and classes, are stored once, and each referencer package without a record gets one stamp.
+*/
+{
+	TArray<FStringEntry> StringEntries;
+	TArray<uint8> StringData;
+	TMap<FName, int32> StringIndices;
+
+	auto AddString = [&StringEntries, &StringData, &StringIndices](const FName& Name)
+		{
+			if (const int32* StringIndex = StringIndices.Find(Name))
+			{
+				return *StringIndex;
+			}
+
+			const FTCHARToUTF8 Utf8Name(*Name.ToString());
+
+			FStringEntry& StringEntry = StringEntries.AddDefaulted_GetRef();
+			StringEntry.Offset = StringData.Num();
+			StringEntry.Length = Utf8Name.Length();
+
+			StringData.Append(reinterpret_cast<const uint8*>(Utf8Name.Get()), Utf8Name.Length());
+
+			return StringIndices.Add(Name, StringEntries.Num() - 1);
+		};
+
+	TArray<FRecord> Records;
+	Records.Reserve(Assets.Num());
+
+	TArray<int32> ReferencerIndices;
+	TSet<FName> RecordedPackages;
+
+	for (const TSharedPtr<FAssetData>& Asset : Assets)
+	{
+		if (PackageTimestamps.Contains(Asset->PackageName))
+		{
+			RecordedPackages.Add(Asset->PackageName);
+		}
+	}
+
+	TArray<FStamp> Stamps;
+	TSet<FName> StampedPackages;
+
+	for (const TSharedPtr<FAssetData>& Asset : Assets)
+	{
+		const FDateTime* Timestamp = PackageTimestamps.Find(Asset->PackageName);
+
+		if (!Timestamp) continue;
+
+		FRecord& Record = Records.AddZeroed_GetRef();
+		Record.TimestampTicks = Timestamp->GetTicks();
+		Record.PackageName = AddString(Asset->PackageName);
+		Record.PackagePath = AddString(Asset->PackagePath);
+		Record.AssetName = AddString(Asset->AssetName);
+		Record.ClassPackageName = AddString(Asset->AssetClassPath.GetPackageName());
+		Record.ClassAssetName = AddString(Asset->AssetClassPath.GetAssetName());
+		Record.FirstReferencer = INDEX_NONE;
+
+		const TArray<FName>* PackageReferencers = Referencers.Find(Asset->PackageName);
+
+		// A referencer without a file can't be checked for changes next time
+		if (PackageReferencers && !PackageReferencers->ContainsByPredicate([&PackageTimestamps](const FName& Referencer)
+			{
+				return !PackageTimestamps.Contains(Referencer);
+			}))
+		{
+			for (const FName& Referencer : *PackageReferencers)
+			{
+				if (RecordedPackages.Contains(Referencer)) continue;
+
+				bool bAlreadyStamped = false;
+				StampedPackages.Add(Referencer, &bAlreadyStamped);
+
+				if (!bAlreadyStamped)
+				{
+					FStamp& Stamp = Stamps.AddZeroed_GetRef();
+					Stamp.TimestampTicks = PackageTimestamps.FindChecked(Referencer).GetTicks();
+					Stamp.PackageName = AddString(Referencer);
+				}
+			}
+
+			Record.FirstReferencer = ReferencerIndices.Num();
+			Record.NumReferencers = PackageReferencers->Num();
+
+			for (const FName& Referencer : *PackageReferencers)
+			{
+				ReferencerIndices.Add(AddString(Referencer));
+			}
+		}
+	}
+
+	FHeader Header;
+	Header.Magic = CacheMagic;
+	Header.Version = CacheVersion;
+	Header.FoldersKey = GetFoldersKey(FolderPaths);
+	Header.NumStrings = StringEntries.Num();
+	Header.NumRecords = Records.Num();
+	Header.NumStamps = Stamps.Num();
+	Header.NumReferencers = ReferencerIndices.Num();
+	Header.StringDataSize = StringData.Num();
+	Header.Padding = 0;
+
+	const FLayout Layout = GetLayout(Header);
+
+	TArray64<uint8> Buffer;
+	Buffer.SetNumZeroed(Layout.Total);
+
+	FMemory::Memcpy(Buffer.GetData(), &Header, sizeof(FHeader));
+	FMemory::Memcpy(Buffer.GetData() + Layout.StringEntries, StringEntries.GetData(), StringEntries.Num() * sizeof(FStringEntry));
+	FMemory::Memcpy(Buffer.GetData() + Layout.Records, Records.GetData(), Records.Num() * sizeof(FRecord));
+	FMemory::Memcpy(Buffer.GetData() + Layout.Stamps, Stamps.GetData(), Stamps.Num() * sizeof(FStamp));
+	FMemory::Memcpy(Buffer.GetData() + Layout.Referencers, ReferencerIndices.GetData(), ReferencerIndices.Num() * sizeof(int32));
+	FMemory::Memcpy(Buffer.GetData() + Layout.StringData, StringData.GetData(), StringData.Num());
+
+	return FFileHelper::SaveArrayToFile(Buffer, *GetFilename(FolderPaths));
+}
+
+#pragma endregion
+
+#pragma region Loading
+
+bool FAssetActionsAuditCache::Load(const TArray<FString>& FolderPaths)
+/*
+	Map the file where the platform supports it so nothing is copied; otherwise read it whole
+*/
+{
+	Unload();
+
+	const FString Filename = GetFilename(FolderPaths);
+
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+
+	if (MappedFile.IsValid() && MappedFile->GetFileSize() > 0)
+	{
+		MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	}
+
+	if (MappedRegion.IsValid())
+	{
+		Data = MappedRegion->GetMappedPtr();
+		DataSize = MappedRegion->GetMappedSize();
+	}
+
+	else if (FFileHelper::LoadFileToArray(LoadedData, *Filename, FILEREAD_Silent))
+	{
+		Data = LoadedData.GetData();
+		DataSize = LoadedData.Num();
+	}
+
+	if (!Data || !IsValidCache(GetFoldersKey(FolderPaths)))
+	{
+		Unload();
+		return false;
+	}
+
+	DecodedNames.SetNum(GetHeader().NumStrings);
+
+	return true;
+}
+
+void FAssetActionsAuditCache::Revalidate(const IAssetActionsCatalog& Catalog, const TMap<FName, FDateTime>& FolderPackageTimestamps,
+	TArray<FAssetData>& OutValidAssets, TMap<FName, TArray<FName>>& OutValidReferencers, TArray<FName>& OutChangedPackages)
+/*
+	Compare the cached timestamps against the folders' files once, and against the files of cached referencers 
+	outside the folders with one stat each. A package counts as unchanged only if its file still has exactly the 
+	cached timestamp; every package under the folders without a record is new, whatever its timestamp.
+*/
+{
+	if (!Data) return;
+
+	const FHeader& Header = GetHeader();
+	const FRecord* Records = GetRecords();
+	const FStamp* Stamps = GetStamps();
+	const int32* Referencers = GetReferencers();
+
+	// Cached timestamp of every package with a record or a stamp
+	TMap<FName, int64> CachedTicks;
+	CachedTicks.Reserve(Header.NumRecords + Header.NumStamps);
+
+	for (int32 RecordIndex = 0; RecordIndex < Header.NumRecords; ++RecordIndex)
+	{
+		CachedTicks.Add(GetName(Records[RecordIndex].PackageName), Records[RecordIndex].TimestampTicks);
+	}
+
+	TArray<FName> OutsidePackages;
+
+	for (int32 StampIndex = 0; StampIndex < Header.NumStamps; ++StampIndex)
+	{
+		const FName PackageName = GetName(Stamps[StampIndex].PackageName);
+		CachedTicks.Add(PackageName, Stamps[StampIndex].TimestampTicks);
+
+		if (!FolderPackageTimestamps.Contains(PackageName))
+		{
+			OutsidePackages.Add(PackageName);
+		}
+	}
+
+	TMap<FName, FDateTime> OutsidePackageTimestamps;
+	Catalog.GetPackageTimestamps(OutsidePackages, OutsidePackageTimestamps);
+
+	auto IsUnchanged = [&CachedTicks, &FolderPackageTimestamps, &OutsidePackageTimestamps](const FName& PackageName)
+		{
+			const int64* Ticks = CachedTicks.Find(PackageName);
+			const FDateTime* Timestamp = FolderPackageTimestamps.Find(PackageName);
+
+			if (!Timestamp)
+			{
+				Timestamp = OutsidePackageTimestamps.Find(PackageName);
+			}
+
+			return Ticks && Timestamp && *Ticks == Timestamp->GetTicks();
+		};
+
+	// New and changed packages under the folders are queried again by the caller
+	for (const TPair<FName, FDateTime>& PackageTimestamp : FolderPackageTimestamps)
+	{
+		if (!IsUnchanged(PackageTimestamp.Key))
+		{
+			OutChangedPackages.Add(PackageTimestamp.Key);
+		}
+	}
+
+	// Referencers outside the folders that still exist but changed may now reference other packages
+	TSet<FName> ChangedPackages(OutChangedPackages);
+
+	for (const TPair<FName, FDateTime>& PackageTimestamp : OutsidePackageTimestamps)
+	{
+		if (!IsUnchanged(PackageTimestamp.Key))
+		{
+			ChangedPackages.Add(PackageTimestamp.Key);
+		}
+	}
+
+	// Packages a changed package references now; a cached referencer list that includes a changed package covers
+	// the references it had before
+	TSet<FName> StaleReferencerPackages;
+	TArray<FName> Dependencies;
+
+	for (const FName& ChangedPackage : ChangedPackages)
+	{
+		Dependencies.Reset();
+		Catalog.GetDependencies(ChangedPackage, Dependencies);
+
+		StaleReferencerPackages.Append(Dependencies);
+	}
+
+	OutValidAssets.Reserve(OutValidAssets.Num() + Header.NumRecords);
+
+	for (int32 RecordIndex = 0; RecordIndex < Header.NumRecords; ++RecordIndex)
+	{
+		const FRecord& Record = Records[RecordIndex];
+		const FName PackageName = GetName(Record.PackageName);
+
+		// Deleted packages are dropped; changed ones are queried again by the caller
+		if (!IsUnchanged(PackageName)) continue;
+
+		OutValidAssets.Emplace(PackageName, GetName(Record.PackagePath), GetName(Record.AssetName),
+			FTopLevelAssetPath(GetName(Record.ClassPackageName), GetName(Record.ClassAssetName)));
+
+		if (Record.FirstReferencer == INDEX_NONE || StaleReferencerPackages.Contains(PackageName)) continue;
+
+		TArray<FName> PackageReferencers;
+		PackageReferencers.Reserve(Record.NumReferencers);
+
+		bool bReferencersValid = true;
+
+		for (int32 ReferencerIndex = Record.FirstReferencer; ReferencerIndex < Record.FirstReferencer + Record.NumReferencers; ++ReferencerIndex)
+		{
+			const FName Referencer = GetName(Referencers[ReferencerIndex]);
+
+			// A deleted referencer no longer counts and a changed one may have dropped the reference
+			if (!IsUnchanged(Referencer))
+			{
+				bReferencersValid = false;
+				break;
+			}
+
+			PackageReferencers.Add(Referencer);
+		}
+
+		if (bReferencersValid)
+		{
+			OutValidReferencers.Add(PackageName, MoveTemp(PackageReferencers));
+		}
+	}
+}
+
+const FAssetActionsAuditCache::FStringEntry* FAssetActionsAuditCache::GetStringEntries() const
+{
+	return reinterpret_cast<const FStringEntry*>(Data + GetLayout(GetHeader()).StringEntries);
+}
+
+const FAssetActionsAuditCache::FRecord* FAssetActionsAuditCache::GetRecords() const
+{
+	return reinterpret_cast<const FRecord*>(Data + GetLayout(GetHeader()).Records);
+}
+
+const FAssetActionsAuditCache::FStamp* FAssetActionsAuditCache::GetStamps() const
+{
+	return reinterpret_cast<const FStamp*>(Data + GetLayout(GetHeader()).Stamps);
+}
+
+const int32* FAssetActionsAuditCache::GetReferencers() const
+{
+	return reinterpret_cast<const int32*>(Data + GetLayout(GetHeader()).Referencers);
+}
+
+FName FAssetActionsAuditCache::GetName(int32 StringIndex)
+{
+	FName& DecodedName = DecodedNames[StringIndex];
+
+	if (DecodedName.IsNone())
+	{
+		const FStringEntry& StringEntry = GetStringEntries()[StringIndex];
+		const ANSICHAR* Utf8Name = reinterpret_cast<const ANSICHAR*>(Data + GetLayout(GetHeader()).StringData + StringEntry.Offset);
+
+		const FUTF8ToTCHAR Name(Utf8Name, StringEntry.Length);
+		DecodedName = FName(Name.Length(), Name.Get());
+	}
+
+	return DecodedName;
+}
+
+void FAssetActionsAuditCache::Unload()
+{
+	// The region has to be released before the file handle it was mapped from
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	LoadedData.Empty();
+	DecodedNames.Empty();
+
+	Data = nullptr;
+	DataSize = 0;
+}
+
+#pragma endregion
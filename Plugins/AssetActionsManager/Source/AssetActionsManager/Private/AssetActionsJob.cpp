@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsJob.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarBulkActionChunkSize(
+	TEXT("AssetActions.BulkActionChunkSize"),
+	25,
+	TEXT("Number of assets a bulk action processes between editor ticks. Larger chunks finish sooner but keep the editor busy longer per tick."));
+
+FAssetActionsJob::FAssetActionsJob(const FString& InActionName, TArray<TSharedPtr<FAssetData>>&& InAssets, FProcessChunk&& InProcessChunk)
+	: ActionName(InActionName)
+	, Assets(MoveTemp(InAssets))
+	, ProcessChunk(MoveTemp(InProcessChunk))
+{
+}
+
+bool FAssetActionsJob::ProcessNextChunk()
+{
+	if (IsFinished()) return false;
+
+	if (NumProcessed == 0)
+	{
+		StartTime = FPlatformTime::Seconds();
+	}
+
+	const int32 ChunkSize = FMath::Min(FMath::Max(CVarBulkActionChunkSize.GetValueOnGameThread(), 1), Assets.Num() - NumProcessed);
+	const TArray<TSharedPtr<FAssetData>> Chunk(Assets.GetData() + NumProcessed, ChunkSize);
+
+	const int32 NumSkippedBefore = SkippedAssets.Num();
+	const bool bChunkChanged = ProcessChunk(Chunk, SkippedAssets);
+
+	// A chunk that changed nothing skipped all of its assets
+	if (!bChunkChanged)
+	{
+		SkippedAssets.SetNum(NumSkippedBefore);
+		SkippedAssets.Append(Chunk);
+	}
+
+	else
+	{
+		const TSet<TSharedPtr<FAssetData>> ChunkSkippedAssets(MakeArrayView(SkippedAssets).RightChop(NumSkippedBefore));
+
+		for (const TSharedPtr<FAssetData>& ChunkAsset : Chunk)
+		{
+			if (!ChunkSkippedAssets.Contains(ChunkAsset))
+			{
+				ChangedAssets.Add(ChunkAsset);
+			}
+		}
+	}
+
+	bChangedAssets |= bChunkChanged;
+	NumProcessed += ChunkSize;
+
+	return !IsFinished();
+}
+
+float FAssetActionsJob::GetProgressFraction() const
+{
+	return Assets.Num() > 0 ? static_cast<float>(NumProcessed) / Assets.Num() : 1.f;
+}
+
+FText FAssetActionsJob::GetProgressText() const
+/*
+	The rate is the average since the job started, which smooths out chunks that hit slow assets
+*/
+{
+	const double ElapsedSeconds = GetElapsedSeconds();
+
+	if (NumProcessed == 0 || ElapsedSeconds <= 0.0)
+	{
+		return FText::FromString(FString::Printf(TEXT("%s: 0 of %d assets"), *ActionName, Assets.Num()));
+	}
+
+	const double AssetsPerSecond = NumProcessed / ElapsedSeconds;
+	const int32 SecondsLeft = FMath::CeilToInt32((Assets.Num() - NumProcessed) / AssetsPerSecond);
+
+	return FText::FromString(FString::Printf(TEXT("%s: %d of %d assets (%.1f per second, about %d:%02d left)"),
+		*ActionName, NumProcessed, Assets.Num(), AssetsPerSecond, SecondsLeft / 60, SecondsLeft % 60));
+}
+
+FString FAssetActionsJob::GetSummary() const
+{
+	return FString::Printf(TEXT("%s %s after %d of %d assets in %.2f s, %d skipped"), *ActionName,
+		bCancelled ? TEXT("cancelled") : TEXT("finished"), NumProcessed, Assets.Num(), GetElapsedSeconds(), SkippedAssets.Num());
+}
+
+double FAssetActionsJob::GetElapsedSeconds() const
+{
+	return NumProcessed > 0 ? FPlatformTime::Seconds() - StartTime : 0.0;
+}
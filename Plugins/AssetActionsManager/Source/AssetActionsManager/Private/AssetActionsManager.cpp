@@ -1,23 +1,189 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AssetActionsManager.h"
-#include "AssetToolsModule.h"
-#include "AssetRegistry/AssetRegistryModule.h"
-#include "AssetViewUtils.h"
+#include "AssetActionsAuditCache.h"
+#include "AssetActionsNamingSettings.h"
+#include "AssetActionsRegistryCatalog.h"
+#include "AssetActionsStats.h"
+#include "AssetActionsUnusedSettings.h"
+#include "Algo/Count.h"
+#include "Async/ParallelFor.h"
 #include "ContentBrowserModule.h" 
 #include "DebugHelper.h"
 #include "EditorAssetLibrary.h"
-#include "ObjectTools.h"
+#include "HAL/IConsoleManager.h"
 #include "SlateWidgets/AssetActionsWidget.h"
 
 #define LOCTEXT_NAMESPACE "FAssetActionsManagerModule"
 
+static TAutoConsoleVariable<bool> CVarCaseSensitiveDuplicateNames(
+	TEXT("AssetActions.CaseSensitiveDuplicateNames"),
+	false,
+	TEXT("When true, asset names that only differ in case are not listed as duplicates."));
+
+static TAutoConsoleVariable<bool> CVarUseAuditCache(
+	TEXT("AssetActions.UseAuditCache"),
+	true,
+	TEXT("When true, the tab opens from the on-disk audit cache in Saved/AssetActionsManager and only queries changed packages."));
+
+static TAutoConsoleVariable<float> CVarTimeSliceBudgetMs(
+	TEXT("AssetActions.TimeSliceBudgetMs"),
+	8.f,
+	TEXT("Milliseconds per editor frame the tab spends listing and filtering assets it can't read from the audit cache. 0 does all of it before the tab updates."));
+
+static TAutoConsoleVariable<int32> CVarParallelFilterChunkSize(
+	TEXT("AssetActions.ParallelFilterChunkSize"),
+	1024,
+	TEXT("Rows per chunk when filters and referencer queries are split across worker threads. 0 runs them on the game thread."));
+
+DECLARE_CYCLE_STAT(TEXT("Load Audit Cache"), STAT_AssetActions_LoadAuditCache, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Save Audit Cache"), STAT_AssetActions_SaveAuditCache, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Get All Asset Data"), STAT_AssetActions_GetAllAssetData, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Enumeration Step"), STAT_AssetActions_EnumerationStep, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Cache Referencers Counts"), STAT_AssetActions_CacheReferencersCounts, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Fix Up Redirectors"), STAT_AssetActions_FixUpRedirectors, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Filter For Unused"), STAT_AssetActions_FilterForUnused, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Filter For Unreachable"), STAT_AssetActions_FilterForUnreachable, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Filter For Duplicate Name"), STAT_AssetActions_FilterForDuplicateName, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Filter For Naming Violations"), STAT_AssetActions_FilterForNamingViolations, STATGROUP_AssetActions);
+
+namespace AssetActionsParallel
+{
+	/** Number of chunks to split items into; a single chunk runs on the calling thread */
+	static int32 GetNumChunks(int32 NumItems)
+	{
+		const int32 ChunkSize = CVarParallelFilterChunkSize.GetValueOnGameThread();
+
+		if (ChunkSize <= 0 || NumItems <= ChunkSize) return 1;
+
+		return FMath::DivideAndRoundUp(NumItems, ChunkSize);
+	}
+
+	/**
+	 * Run ChunkBody over contiguous ranges of items, on worker threads when there is more than one chunk
+	 *
+	 * @note: Ranges follow item order, so results kept per chunk and merged in chunk order come out exactly 
+	 *		  as a serial pass would produce them, whatever the number of threads.
+	 */
+	static void ForEachChunk(int32 NumItems, int32 NumChunks, TFunctionRef<void(int32 ChunkIndex, int32 Begin, int32 End)> ChunkBody)
+	{
+		ParallelFor(NumChunks, [NumItems, NumChunks, &ChunkBody](int32 ChunkIndex)
+			{
+				const int32 Begin = static_cast<int32>(static_cast<int64>(NumItems) * ChunkIndex / NumChunks);
+				const int32 End = static_cast<int32>(static_cast<int64>(NumItems) * (ChunkIndex + 1) / NumChunks);
+
+				ChunkBody(ChunkIndex, Begin, End);
+			},
+			NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
+
+	/** Get the live rows set in a bitset, in ascending order */
+	static TArray<int32> GatherRows(const FAssetActionsTable& AssetTable, const TBitArray<>& Rows)
+	{
+		TArray<int32> LiveRows;
+
+		for (TConstSetBitIterator<> It(Rows); It; ++It)
+		{
+			if (AssetTable.IsValidRow(It.GetIndex()))
+			{
+				LiveRows.Add(It.GetIndex());
+			}
+		}
+
+		return LiveRows;
+	}
+
+	/**
+	 * Check rows on worker threads, collecting the rows that pass per chunk
+	 *
+	 * @param RowPasses: called concurrently for every live row in RowsToFilter, so it may only read
+	 * @return TBitArray: bitset sized to the asset table with a bit set for every row that passed
+	 */
+	static TBitArray<> FilterRows(const FAssetActionsTable& AssetTable, const TBitArray<>& RowsToFilter, TFunctionRef<bool(int32 Row)> RowPasses)
+	{
+		const TArray<int32> Rows = GatherRows(AssetTable, RowsToFilter);
+		const int32 NumChunks = GetNumChunks(Rows.Num());
+
+		TArray<TArray<int32>> PassedRowsByChunk;
+		PassedRowsByChunk.SetNum(NumChunks);
+
+		ForEachChunk(Rows.Num(), NumChunks, [&Rows, &PassedRowsByChunk, &RowPasses](int32 ChunkIndex, int32 Begin, int32 End)
+			{
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					if (RowPasses(Rows[Index]))
+					{
+						PassedRowsByChunk[ChunkIndex].Add(Rows[Index]);
+					}
+				}
+			});
+
+		// Bits share words, so they are only written here on the calling thread
+		TBitArray<> PassedRows(false, AssetTable.GetMaxRows());
+
+		for (const TArray<int32>& ChunkPassedRows : PassedRowsByChunk)
+		{
+			for (const int32 Row : ChunkPassedRows)
+			{
+				PassedRows[Row] = true;
+			}
+		}
+
+		return PassedRows;
+	}
+}
+
 void FAssetActionsManagerModule::StartupModule()
 {
-	InitCBMenuExtension();
-	RegisterAssetActionsTab();
+	// Commandlets reuse the asset table and filters but never show the menu entry or tab
+	if (!IsRunningCommandlet())
+	{
+		InitCBMenuExtension();
+		RegisterAssetActionsTab();
+	}
+
+	SetCatalog(MakeShared<FAssetActionsRegistryCatalog>());
+
+	NamingSettingsChangedHandle = GetMutableDefault<UAssetActionsNamingSettings>()->OnSettingChanged().AddRaw(
+		this, &FAssetActionsManagerModule::OnNamingSettingsChanged);
+
+	UnusedSettingsChangedHandle = GetMutableDefault<UAssetActionsUnusedSettings>()->OnSettingChanged().AddRaw(
+		this, &FAssetActionsManagerModule::OnUnusedSettingsChanged);
+}
+
+#pragma region Catalog
+
+void FAssetActionsManagerModule::SetCatalog(const TSharedRef<IAssetActionsCatalog>& InCatalog)
+/*
+	Everything cached from the previous catalog describes assets that may not exist in the new one, 
+	so the table, referencer cache and redirector tracking all start over
+*/
+{
+	UnbindCatalogEvents();
+	CancelAssetTableEnumeration();
+
+	Catalog = InCatalog;
+
+	AssetTable.Reset(TArray<FAssetData>());
+	AssetTableFolderPaths.Empty();
+	CachedReferencers.Empty();
+	CachedPackagesByReferencer.Empty();
+	UnverifiedCachedReferencers.Empty();
+	PendingRedirectorPackages.Empty();
+	RedirectorSweptFolderPaths.Empty();
+	bFolderRedirectorsDirty = true;
+	Reachability.Reset();
+	ReachabilityChangedPackages.Reset();
+	bReachabilityDirty = true;
+	bReachabilityStale = false;
+
+	NamingRules.SetCatalog(Catalog.Get());
+
+	BindCatalogEvents();
 }
 
+#pragma endregion
+
 #pragma region ExtendContentBrowserMenu
 
 void FAssetActionsManagerModule::InitCBMenuExtension()
@@ -117,440 +283,1558 @@ void FAssetActionsManagerModule::RegisterAssetActionsTab()
 
 TSharedRef<SDockTab> FAssetActionsManagerModule::OnSpawnAssetActionsTab(const FSpawnTabArgs& AssetActionsTabArgs)
 /*
-	Construct an SDockTab and assign the SLATE_ARGUMENT in the widget to the asset data found in the selected folder
+	Construct an SDockTab after filling the asset table with the assets found in the selected folder,
+	from the audit cache when there is a usable one
 */
 {
+	if (!LoadAssetTableFromAuditCache())
+	{
+		// With a budget the tab fills the table a slice per frame once it is open
+		if (GetTimeSliceBudgetSeconds() > 0.0)
+		{
+			BeginAssetTableEnumeration();
+		}
+
+		else
+		{
+			RefreshAssetTable();
+		}
+	}
+
 	AssetActionsTab =
 		SNew(SDockTab).TabRole(ETabRole::NomadTab)
+		.OnTabClosed_Raw(this, &FAssetActionsManagerModule::OnAssetActionsTabClosed)
 		[
 			SNew(SAssetActionsTab)
-				.AllAssetsDataFromManager(GetAllAssetDataUnderSelectedFolder()) // matches the SLATE_ARGUMENT in widget file
-				.SelectedFoldersPaths(SelectedFolderPaths)
+				.SelectedFoldersPaths(SelectedFolderPaths) // matches the SLATE_ARGUMENT in widget file
 		];
 
 	return AssetActionsTab.ToSharedRef();
 }
 
-TArray<TSharedPtr<FAssetData>> FAssetActionsManagerModule::GetAllAssetDataUnderSelectedFolder()
+TArray<FAssetData> FAssetActionsManagerModule::GetAllAssetDataUnderSelectedFolder()
 /*
-	From selected folder path, list all assets and add to array. For every asset path in the array,
-	find the asset data and return an array of asset data.
+	Query the catalog once for all assets under the selected folders (recursively) and 
+	return them, skipping redirectors and excluded engine folders.
 */
 {
-	TArray<TSharedPtr<FAssetData>> AllAssetsData; // type matches what item source in widget expects
-	TArray<FString> AllAssetsPathsNames;
+	ASSET_ACTIONS_SCOPE(GetAllAssetData);
+
+	TArray<FAssetData> AllAssetsData;
+
+	// Single filter covering every selected folder
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
 
-	// Use List Assets to get all assets paths
-	for (const FString SelectedFolderPath : SelectedFolderPaths)
+	for (const FString& SelectedFolderPath : SelectedFolderPaths)
 	{
-		TArray<FString> AssetsPathNames = UEditorAssetLibrary::ListAssets(SelectedFolderPath);
-		AllAssetsPathsNames.Append(AssetsPathNames);
+		Filter.PackagePaths.Emplace(*SelectedFolderPath);
 	}
 
+	TArray<FAssetData> AssetList;
+	Catalog->GetAssets(Filter, AssetList);
+
 	// Check if selected folder contains assets - might move this to an if check in the widget and display no results
-	if (AllAssetsPathsNames.Num() == 0)
+	if (AssetList.Num() == 0)
 	{
-		DebugHelper::MessageDialogBox(EAppMsgType::Ok, TEXT("No assets found under selected folder"));
-	}
+		// The audit commandlet lists folders through here and must never wait on a dialog
+		if (IsRunningCommandlet())
+		{
+			DebugHelper::PrintLog(TEXT("No assets found under selected folder"));
+		}
 
-	for (FString AssetPathName : AllAssetsPathsNames)
-	{
-		// Don't delete any required UE assets
-		if (AssetPathName.Contains(TEXT("Developers")) ||
-			AssetPathName.Contains(TEXT("Collections")) ||
-			AssetPathName.Contains(TEXT("__ExternalActors__")) ||
-			AssetPathName.Contains(TEXT("__ExternalObjects__")))
+		else
 		{
-			continue;
+			DebugHelper::MessageDialogBox(EAppMsgType::Ok, TEXT("No assets found under selected folder"));
 		}
+	}
 
-		// Avoid TryConvertFilenameToLongPackageName warning
-		TArray<FString> PathNameArray;
-		AssetPathName.ParseIntoArray(PathNameArray, TEXT("."));
-		AssetPathName = PathNameArray[0];
+	AllAssetsData.Reserve(AssetList.Num());
 
-		// If asset does not exist, skip and move to next asset
-		if (!UEditorAssetLibrary::DoesAssetExist(AssetPathName)) continue;
+	// Exclusion results per package path so each folder is only checked once
+	TMap<FName, bool> ExcludedPathsCache;
 
+	for (FAssetData& AssetData : AssetList)
+	{
+		if (AssetData.IsRedirector()) continue;
 
-		// Get asset data and add to array to pass to widget
-		FAssetData AssetData = UEditorAssetLibrary::FindAssetData(AssetPathName);
+		// Don't delete any required UE assets
+		if (IsExcludedPackagePath(AssetData.PackagePath, ExcludedPathsCache)) continue;
 
-		AllAssetsData.Add(MakeShared<FAssetData>(AssetData));
+		AllAssetsData.Add(MoveTemp(AssetData));
 	}
 
 	return AllAssetsData;
 }
 
-#pragma endregion
-
-#pragma region ProcessDataForWidget
-
-int32 FAssetActionsManagerModule::GetAssetReferencersCount(const TSharedPtr<FAssetData>& AssetData)
+void FAssetActionsManagerModule::RefreshAssetTable()
 /*
-	Return a count of all the asset references found for AssetData
+	Replace the asset table rows with a fresh enumeration of the selected folders
 */
 {
-	TArray<FString> AssetReferencers =
-		UEditorAssetLibrary::FindPackageReferencersForAsset(AssetData->GetSoftObjectPath().GetLongPackageName());
+	CancelAssetTableEnumeration();
 
-	return AssetReferencers.Num();
+	AssetTable.Reset(GetAllAssetDataUnderSelectedFolder());
+	AssetTableFolderPaths = SelectedFolderPaths;
+	NamingRules.ResetClassCache();
 }
 
-void FAssetActionsManagerModule::SyncCBToClickedAsset(const FString& ClickedAssetPath)
+void FAssetActionsManagerModule::RefreshAssetTableForFolders(const TArray<FString>& FolderPaths)
 /*
-	Navigate the content browser to the ClickedAssetPath
+	Select the folders as if they were picked in the content browser, then enumerate them
 */
 {
-	// Convert path to array since that is what SyncBrowserToObjects expects
-	TArray<FString> AssetPathToSync;
-	AssetPathToSync.Add(ClickedAssetPath);
-
-	UEditorAssetLibrary::SyncBrowserToObjects(AssetPathToSync);
+	SelectedFolderPaths = FolderPaths;
+	RefreshAssetTable();
 }
 
-void FAssetActionsManagerModule::FixUpRedirectors()
+void FAssetActionsManagerModule::BeginAssetTableEnumeration()
 /*
-	Fix up any redirectors created on the whole project
+	Gather every folder to list up front from the catalog's path tree, which is far cheaper than listing assets, 
+	so each step only lists whole folders. Folders inside more than one selected folder are listed once.
 */
 {
-	IAssetRegistry& AssetRegistry =
-		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	CancelAssetTableEnumeration();
 
-	// Create filter with asset paths
-	FARFilter Filter;
-	Filter.bRecursivePaths = true;
-	Filter.PackagePaths.Emplace("/Game");
-	Filter.ClassPaths.Add(UObjectRedirector::StaticClass()->GetClassPathName());
-
-	// Query for assets in selected paths
-	TArray<FAssetData> AssetList;
-	AssetRegistry.GetAssets(Filter, AssetList);
+	AssetTable.Reset(TArray<FAssetData>());
+	AssetTableFolderPaths.Empty();
+	NamingRules.ResetClassCache();
 
-	if (AssetList.Num() == 0) return;
+	EnumerationFolderPaths = SelectedFolderPaths;
 
-	// Get paths for each asset
-	TArray<FString> ObjectPaths;
+	TSet<FName> QueuedPaths;
+	TArray<FName> FolderPaths;
 
-	for (const FAssetData& Asset : AssetList)
+	for (const FString& SelectedFolderPath : EnumerationFolderPaths)
 	{
-		ObjectPaths.Add(Asset.GetObjectPathString());
-	}
+		const FName SelectedPackagePath(SelectedFolderPath);
 
-	// Load assets
-	TArray<UObject*> Objects;
-	bool Result = AssetViewUtils::LoadAssetsIfNeeded(ObjectPaths, Objects, true, true);
+		FolderPaths.Reset();
+		FolderPaths.Add(SelectedPackagePath);
+		Catalog->GetSubPaths(SelectedPackagePath, FolderPaths);
 
-	if (Result)
-	{
-		// Convert objects to object redirectors
-		TArray<UObjectRedirector*> Redirectors;
-		for (UObject* Object : Objects)
+		for (const FName& FolderPath : FolderPaths)
 		{
-			Redirectors.Add(CastChecked<UObjectRedirector>(Object));
-		}
+			bool bAlreadyQueued = false;
+			QueuedPaths.Add(FolderPath, &bAlreadyQueued);
 
-		// Call fix up redirectors from asset tools
-		FAssetToolsModule& AssetToolsModule =
-			FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-
-		AssetToolsModule.Get().FixupReferencers(Redirectors);
+			if (!bAlreadyQueued)
+			{
+				EnumerationPaths.Add(FolderPath);
+			}
+		}
 	}
 }
 
-TArray<TSharedPtr<FAssetData>> FAssetActionsManagerModule::FilterForUnusedAssetData(const TArray<TSharedPtr<FAssetData>>& AssetDataToFilter)
+bool FAssetActionsManagerModule::StepAssetTableEnumeration(double BudgetSeconds, TArray<int32>& OutAddedRows)
 /*
-	Return an array of unsused assets by checking count of asset referencers for all assets under selected folder 
+	List one folder at a time until the budget is spent, so a step overruns its budget by at most one folder.
+	At least one folder is listed per step so the enumeration finishes under any budget.
 */
 {
-	TArray<TSharedPtr<FAssetData>> UnusedAssetsData;
+	ASSET_ACTIONS_SCOPE(EnumerationStep);
+
+	if (!IsEnumeratingAssetTable()) return false;
+
+	const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+
+	FARFilter Filter;
+	TArray<FAssetData> FolderAssets;
 
-	for (const TSharedPtr<FAssetData>& AssetData : AssetDataToFilter)
+	do
 	{
+		const FName PackagePath = EnumerationPaths[NextEnumerationPath++];
 
-		// Skip level maps
-		if (AssetData->GetClass()->GetName() == TEXT("World")) continue;
+		// Don't list any required UE assets
+		if (IsExcludedPackagePath(PackagePath, EnumerationExcludedPaths)) continue;
 
-		if (GetAssetReferencersCount(AssetData) == 0)
+		Filter.PackagePaths.Reset();
+		Filter.PackagePaths.Add(PackagePath);
+
+		FolderAssets.Reset();
+		Catalog->GetAssets(Filter, FolderAssets);
+
+		for (const FAssetData& AssetData : FolderAssets)
 		{
-			UnusedAssetsData.Add(AssetData);
+			if (AssetData.IsRedirector()) continue;
+
+			OutAddedRows.Add(AssetTable.AddRow(AssetData));
 		}
 	}
+	while (IsEnumeratingAssetTable() && FPlatformTime::Seconds() < EndTime);
 
-	return UnusedAssetsData;
-}
+	if (IsEnumeratingAssetTable()) return true;
 
-TArray<TSharedPtr<FAssetData>> FAssetActionsManagerModule::FilterForDuplicateNameData(const TArray<TSharedPtr<FAssetData>>& AssetDataToFilter)
-/*
-	Return an array of duplicate name assets by using a multimap to find asset names with more than one value
-*/
-{
-	TMultiMap<FString, TSharedPtr<FAssetData>> AssetsInfoMap;
-	TArray<TSharedPtr<FAssetData>> DuplicatedAssetData;
+	// The table now describes the folders as a synchronous refresh would, so it can be cached when the tab closes
+	AssetTableFolderPaths = EnumerationFolderPaths;
+	CancelAssetTableEnumeration();
 
-	for (const TSharedPtr<FAssetData>& AssetData : AssetDataToFilter)
+	// This runs from the tab's active timer, so report an empty table without blocking the frame on a modal dialog
+	if (AssetTable.Num() == 0)
 	{
-		AssetsInfoMap.Emplace(AssetData->AssetName.ToString(), AssetData);
+		DebugHelper::NotificationPopup(TEXT("No assets found under selected folder"));
 	}
 
-	for (const TSharedPtr<FAssetData>& AssetData : AssetDataToFilter)
-	{
-		TArray<TSharedPtr<FAssetData>> FoundNamesArray;
-
-		AssetsInfoMap.MultiFind(AssetData->AssetName.ToString(), FoundNamesArray);
-
-		if (FoundNamesArray.Num() <= 1) continue;
+	return false;
+}
 
-		for (const TSharedPtr<FAssetData>& DuplicatedNameData : FoundNamesArray)
-		{
-			if (DuplicatedNameData.IsValid())
-			{
-				DuplicatedAssetData.AddUnique(DuplicatedNameData);
-			}
-		}
-	}
+double FAssetActionsManagerModule::GetTimeSliceBudgetSeconds() const
+{
+	return FMath::Max(0.f, CVarTimeSliceBudgetMs.GetValueOnGameThread()) / 1000.0;
+}
 
-	return DuplicatedAssetData;
+void FAssetActionsManagerModule::CancelAssetTableEnumeration()
+{
+	EnumerationPaths.Empty();
+	NextEnumerationPath = 0;
+	EnumerationFolderPaths.Empty();
+	EnumerationExcludedPaths.Empty();
 }
 
-TArray<TSharedPtr<FAssetData>> FAssetActionsManagerModule::FilterForNoPrefixData(const TArray<TSharedPtr<FAssetData>>& AssetDataToFilter)
+bool FAssetActionsManagerModule::IsAssetInFolders(const FAssetData& AssetData, const TArray<FString>& FolderPaths) const
 /*
-	Return an array of assets with no prefix (or incorrect prefix) by checking asset names against the prefix map
+	Return true if the asset is under one of the folder paths (recursively) and would be returned by an enumeration
 */
 {
-	TArray<TSharedPtr<FAssetData>> NoPrefixAssets;
-
-	for (const TSharedPtr<FAssetData>& Asset : AssetDataToFilter)
-	{
-		FString* PrefixFound = PrefixesMap.Find(Asset->GetClass()->GetName());
-		FString AssetName = Asset->AssetName.ToString();
-
-		// skip maps
-		if (Asset->GetClass()->GetName() == TEXT("World")) { continue; }
+	if (AssetData.IsRedirector()) return false;
 
-		if (!PrefixFound)
-		{
-			DebugHelper::PrintLog("No prefix found for asset: " + AssetName);
-			continue;
-		}
-
-		else
-		{
-			if (!AssetName.Contains(*PrefixFound))
-			{
-				NoPrefixAssets.Add(Asset);
-			}
-		}
-	}
+	if (!IsPackagePathInFolders(AssetData.PackagePath, FolderPaths)) return false;
 
-	return NoPrefixAssets;
+	TMap<FName, bool> ExcludedPathsCache;
+	return !IsExcludedPackagePath(AssetData.PackagePath, ExcludedPathsCache);
 }
 
-bool FAssetActionsManagerModule::DeleteAssetsInList(const TArray<FAssetData>& AssetsToDelete)
+bool FAssetActionsManagerModule::IsPackagePathInFolders(const FName& PackagePath, const TArray<FString>& FolderPaths) const
 /*
-	Return true if assets were successfully deleted; else return false
+	Return true if the package path is one of the folder paths or any of their subfolders
 */
 {
-	if (ObjectTools::DeleteAssets(AssetsToDelete) > 0)
+	if (FolderPaths.IsEmpty()) return false;
+
+	const FString PackagePathString = PackagePath.ToString();
+
+	for (const FString& FolderPath : FolderPaths)
 	{
-		return true;
+		// Match the folder itself or any subfolder, but not sibling folders sharing a name prefix
+		if (PackagePathString.StartsWith(FolderPath) && 
+			(PackagePathString.Len() == FolderPath.Len() || PackagePathString[FolderPath.Len()] == TEXT('/')))
+		{
+			return true;
+		}
 	}
 
 	return false;
 }
 
-bool FAssetActionsManagerModule::RenameAssetInList(const FString& NewName, const TSharedPtr<FAssetData>& AssetToRename)
+bool FAssetActionsManagerModule::IsExcludedPackagePath(const FName& PackagePath, TMap<FName, bool>& ExcludedPathsCache) const
 /*
-	Return true if assets were successfully renamed; else return false
+	Return true if the package path is inside a folder that holds required UE assets. 
+	Results are cached per path since many assets share the same parent folder.
 */
 {
-	const FString OldAssetPath = AssetToRename->GetObjectPathString();
-	const FString NewAssetPath = FPaths::Combine(AssetToRename->PackagePath.ToString(), NewName);
+	if (const bool* bFoundExcluded = ExcludedPathsCache.Find(PackagePath))
+	{
+		return *bFoundExcluded;
+	}
 
-	if (UEditorAssetLibrary::RenameAsset(OldAssetPath, NewAssetPath))
+	const FString PackagePathString = PackagePath.ToString();
+	bool bExcluded = false;
+
+	for (const TCHAR* ExcludedFolder : ExcludedFolderNames)
 	{
-		UEditorAssetLibrary::SaveAsset(NewAssetPath, false);
-		return true;
+		if (PackagePathString.Contains(ExcludedFolder))
+		{
+			bExcluded = true;
+			break;
+		}
 	}
 
-	return false;
+	ExcludedPathsCache.Add(PackagePath, bExcluded);
+
+	return bExcluded;
 }
 
-bool FAssetActionsManagerModule::DuplicateAssetsInList(int32 NumOfDuplicates, const TArray<TSharedPtr<FAssetData>>& AssetsToDuplicate)
+#pragma endregion
+
+#pragma region AuditCache
+
+bool FAssetActionsManagerModule::LoadAssetTableFromAuditCache()
 /*
-	Return true if assets were successfully duplicated; else return false
+	Take the cached assets and referencers that are still valid, then add back the changed packages that belong 
+	under the selected folders with a single catalog query. Referencers already cached this session are kept 
+	since catalog events have kept them current; the ones taken from the audit cache are checked on first use.
 */
 {
-	uint32 Count = 0;
+	ASSET_ACTIONS_SCOPE(LoadAuditCache);
 
-	if (NumOfDuplicates <= 0) { return false; }
+	if (!CVarUseAuditCache.GetValueOnGameThread() || SelectedFolderPaths.IsEmpty()) return false;
 
-	for (const TSharedPtr<FAssetData>& AssetToDuplicate : AssetsToDuplicate)
-	{
-		for (int32 i = 0; i < NumOfDuplicates; ++i)
-		{
-			FString SourceAssetPath = AssetToDuplicate->GetObjectPathString();
-			// Avoid TryConvertFilenameToLongPackageName warning
-			TArray<FString> PathNameArray;
-			SourceAssetPath.ParseIntoArray(PathNameArray, TEXT("."));
-			SourceAssetPath = PathNameArray[0];
+	const double StartTime = FPlatformTime::Seconds();
 
-			// Get existing assets to check name
-			TArray<TSharedPtr<FAssetData>> AllAssets = GetAllAssetDataUnderSelectedFolder();
-			TArray<FString> AssetNames;
+	FAssetActionsAuditCache AuditCache;
 
-			for (TSharedPtr<FAssetData> Asset : AllAssets)
-			{
-				AssetNames.AddUnique(Asset->AssetName.ToString());
-			}
+	if (!AuditCache.Load(SelectedFolderPaths)) return false;
 
-			FString DuplicatedAssetName = AssetToDuplicate->AssetName.ToString() + FString::FromInt(i + 1);
+	TMap<FName, FDateTime> PackageTimestamps;
 
-			// if duplicated name already found, add number to suffix
-			for (int32 j = 1; j < AssetNames.Num(); ++j)
-			{
-				if (AssetNames[j] == DuplicatedAssetName)
-				{
-					DuplicatedAssetName = AssetToDuplicate->AssetName.ToString() + FString::FromInt(i + 1 + j);
-				}
-			}
+	if (!Catalog->GetFolderPackageTimestamps(SelectedFolderPaths, PackageTimestamps)) return false;
 
-			const FString NewAssetPath = FPaths::Combine(AssetToDuplicate->PackagePath.ToString(), DuplicatedAssetName);
+	TArray<FAssetData> AssetsData;
+	TMap<FName, TArray<FName>> ValidReferencers;
+	TArray<FName> ChangedPackages;
+
+	AuditCache.Revalidate(*Catalog, PackageTimestamps, AssetsData, ValidReferencers, ChangedPackages);
+
+	const int32 NumCachedAssets = AssetsData.Num();
+
+	if (!ChangedPackages.IsEmpty())
+	{
+		FARFilter ChangedFilter;
+		ChangedFilter.PackageNames = ChangedPackages;
+
+		TArray<FAssetData> ChangedAssets;
+		Catalog->GetAssets(ChangedFilter, ChangedAssets);
 
-			if (UEditorAssetLibrary::DuplicateAsset(SourceAssetPath, NewAssetPath))
+		for (FAssetData& ChangedAsset : ChangedAssets)
+		{
+			if (IsAssetInFolders(ChangedAsset, SelectedFolderPaths))
 			{
-				UEditorAssetLibrary::SaveAsset(NewAssetPath, false);
-				++Count;
+				AssetsData.Add(MoveTemp(ChangedAsset));
 			}
 		}
 	}
 
-	if (Count > 0)
+	for (TPair<FName, TArray<FName>>& PackageReferencers : ValidReferencers)
 	{
-		return true;
+		if (CachedReferencers.Contains(PackageReferencers.Key)) continue;
+
+		AddCachedReferencers(PackageReferencers.Key, MoveTemp(PackageReferencers.Value));
+		UnverifiedCachedReferencers.Add(PackageReferencers.Key);
 	}
-	
-	return false;
+
+	CancelAssetTableEnumeration();
+
+	AssetTable.Reset(MoveTemp(AssetsData));
+	AssetTableFolderPaths = SelectedFolderPaths;
+	NamingRules.ResetClassCache();
+
+	DebugHelper::PrintLog(FString::Printf(TEXT("Audit cache: %d assets reused, %d changed packages revalidated in %.2f ms"), 
+		NumCachedAssets, ChangedPackages.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0));
+
+	return true;
 }
 
-bool FAssetActionsManagerModule::AddPrefixesToAssetsInList(const TArray<TSharedPtr<FAssetData>>& AssetsToAddPrefixes)
+void FAssetActionsManagerModule::SaveAuditCache()
 /*
-	Return true if prefixes were successfully added to asset names; else return false
+	Walk the table's folders for their timestamps, then stat only the cached referencers outside them
 */
 {
-	uint32 Count = 0;
-	for (const TSharedPtr<FAssetData>& Asset : AssetsToAddPrefixes)
-	{
-		FString* PrefixFound = PrefixesMap.Find(Asset->GetClass()->GetName());
-		FString OldName = Asset->AssetName.ToString();
-
-		// skip maps
-		if (Asset->GetClass()->GetName() == TEXT("World")) { continue; }
+	ASSET_ACTIONS_SCOPE(SaveAuditCache);
 
-		if (!PrefixFound)
-		{
-			DebugHelper::PrintLog("No prefix found for asset: " + OldName);
-			continue;
-		}
+	if (!CVarUseAuditCache.GetValueOnGameThread() || AssetTableFolderPaths.IsEmpty() || AssetTable.Num() == 0) return;
 
-		if (OldName.StartsWith(*PrefixFound))
-		{
-			DebugHelper::PrintLog(OldName + " already has prefix added");
-			continue;
-		}
+	TMap<FName, FDateTime> PackageTimestamps;
 
-		// Remove Unreal default _Inst for Material Instances
-		if (Asset->GetClass()->GetName() == TEXT("MaterialInstanceConstant"))
-		{
-			if (OldName.Contains(TEXT("_Inst")))
-			{
+	if (!Catalog->GetFolderPackageTimestamps(AssetTableFolderPaths, PackageTimestamps)) return;
 
-				TArray<FString> NameArray;
-				OldName.ParseIntoArray(NameArray, TEXT("_Inst"));
+	TArray<TSharedPtr<FAssetData>> AssetItems;
+	AssetTable.GetItems(AssetTable.GetLiveRows(), AssetItems);
 
-				OldName.Empty();
+	TSet<FName> OutsideReferencers;
 
-				for (FString Name : NameArray)
+	for (const TSharedPtr<FAssetData>& AssetItem : AssetItems)
+	{
+		if (const TArray<FName>* PackageReferencers = CachedReferencers.Find(AssetItem->PackageName))
+		{
+			for (const FName& Referencer : *PackageReferencers)
+			{
+				if (!PackageTimestamps.Contains(Referencer))
 				{
-					OldName.Append(Name);
+					OutsideReferencers.Add(Referencer);
 				}
 			}
-
-			OldName.RemoveFromStart(TEXT("M_"));
 		}
+	}
 
-		const FString NewNameWithPrefix = *PrefixFound + OldName;
+	Catalog->GetPackageTimestamps(OutsideReferencers.Array(), PackageTimestamps);
 
-		FString OldAssetPath = Asset->GetObjectPathString();
-		
-		// Avoid TryConvertFilenameToLongPackageName warning
-		TArray<FString> PathNameArray;
-		OldAssetPath.ParseIntoArray(PathNameArray, TEXT("."));
-		OldAssetPath = PathNameArray[0];
+	if (!FAssetActionsAuditCache::Save(AssetTableFolderPaths, AssetItems, PackageTimestamps, CachedReferencers))
+	{
+		DebugHelper::PrintLog(TEXT("Failed to write audit cache ") + FAssetActionsAuditCache::GetFilename(AssetTableFolderPaths));
+	}
+}
 
-		const FString NewAssetPath = FPaths::Combine(Asset->PackagePath.ToString(), NewNameWithPrefix);
+void FAssetActionsManagerModule::OnAssetActionsTabClosed(TSharedRef<SDockTab> ClosedTab)
+/*
+	A table the tab was still filling is never cached, since its folder paths are only set once listing finishes
+*/
+{
+	CancelAssetTableEnumeration();
+	SaveAuditCache();
 
-		if (UEditorAssetLibrary::RenameAsset(OldAssetPath, NewAssetPath))
-		{
-			UEditorAssetLibrary::SaveAsset(NewAssetPath, false);
-			++Count;
-		}
+	AssetActionsTab = nullptr;
+}
 
-	}
+#pragma endregion
 
-	if (Count > 0)
-	{
-		return true;
-	}
-	
-	return false;
+#pragma region ProcessDataForWidget
+
+int32 FAssetActionsManagerModule::GetAssetReferencersCount(const TSharedPtr<FAssetData>& AssetData)
+/*
+	Return a count of all the asset references found for AssetData
+*/
+{
+	return FindOrQueryReferencers(AssetData->PackageName).Num();
 }
 
-bool FAssetActionsManagerModule::ReplaceString(const FString& OldString, const FString& NewString, const TArray<TSharedPtr<FAssetData>>& AssetsToReplace)
+void FAssetActionsManagerModule::CacheAssetReferencersCounts(const TBitArray<>& Rows)
 /*
-	Return true if user entered string to replace was successfully replaced with new string; else return false
+	Fill the referencer cache for all rows in one pass so later lookups never hit the catalog. Packages missing 
+	from the cache or not yet checked since the audit cache load are queried on worker threads into one slot each, 
+	then cached in row order on this thread.
 */
 {
-	uint32 Count = 0;
+	ASSET_ACTIONS_SCOPE(CacheReferencersCounts);
 
-	for (const TSharedPtr<FAssetData>& Asset : AssetsToReplace)
+	TArray<FName> PackagesToQuery;
+	TSet<FName> QueuedPackages;
+
+	for (TConstSetBitIterator<> It(Rows); It; ++It)
 	{
-		const FString OldAssetName = Asset->AssetName.ToString();
+		if (!AssetTable.IsValidRow(It.GetIndex())) continue;
 
-		if (OldAssetName.Contains(OldString, ESearchCase::CaseSensitive))
+		const FName& PackageName = AssetTable.GetPackageName(It.GetIndex());
+
+		if (CachedReferencers.Contains(PackageName) && !UnverifiedCachedReferencers.Contains(PackageName)) continue;
+
+		bool bAlreadyQueued = false;
+		QueuedPackages.Add(PackageName, &bAlreadyQueued);
+
+		if (!bAlreadyQueued)
 		{
-			FString NewAssetName = OldAssetName.Replace(*OldString, *NewString, ESearchCase::CaseSensitive);
+			PackagesToQuery.Add(PackageName);
+		}
+	}
+
+	if (PackagesToQuery.IsEmpty()) return;
 
-			FString OldAssetPath = Asset->GetObjectPathString();
-			
-			// Avoid TryConvertFilenameToLongPackageName warning
-			TArray<FString> PathNameArray;
-			OldAssetPath.ParseIntoArray(PathNameArray, TEXT("."));
-			OldAssetPath = PathNameArray[0];
+	TArray<TArray<FName>> QueriedReferencers;
+	QueriedReferencers.SetNum(PackagesToQuery.Num());
 
-			const FString NewAssetPath = FPaths::Combine(Asset->PackagePath.ToString(), NewAssetName);
+	const IAssetActionsCatalog& QueryCatalog = *Catalog;
 
-			if (UEditorAssetLibrary::RenameAsset(OldAssetPath, NewAssetPath))
+	AssetActionsParallel::ForEachChunk(PackagesToQuery.Num(), AssetActionsParallel::GetNumChunks(PackagesToQuery.Num()),
+		[&QueryCatalog, &PackagesToQuery, &QueriedReferencers](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			for (int32 Index = Begin; Index < End; ++Index)
 			{
-				UEditorAssetLibrary::SaveAsset(NewAssetPath, false);
-				++Count;
+				QueryCatalog.GetReferencers(PackagesToQuery[Index], QueriedReferencers[Index]);
 			}
-		}
-	}
+		});
 
-	if (Count > 0)
+	for (int32 Index = 0; Index < PackagesToQuery.Num(); ++Index)
 	{
-		return true;
+		RemoveCachedReferencers(PackagesToQuery[Index]);
+		AddCachedReferencers(PackagesToQuery[Index], MoveTemp(QueriedReferencers[Index]));
+	}
+}
+
+void FAssetActionsManagerModule::SyncCBToClickedAsset(const FString& ClickedAssetPath)
+/*
+	Navigate the content browser to the ClickedAssetPath
+*/
+{
+	// Convert path to array since that is what SyncBrowserToObjects expects
+	TArray<FString> AssetPathToSync;
+	AssetPathToSync.Add(ClickedAssetPath);
+
+	UEditorAssetLibrary::SyncBrowserToObjects(AssetPathToSync);
+}
+
+void FAssetActionsManagerModule::FixUpRedirectors()
+/*
+	Fix up redirectors left behind by the plugin's own renames, plus redirectors under the selected folders.
+	The folder query only runs when the selected folders changed or a redirector was added under them 
+	since the last sweep, so calling this is free when nothing new was redirected.
+*/
+{
+	ASSET_ACTIONS_SCOPE(FixUpRedirectors);
+
+	const bool bSweepSelectedFolders = bFolderRedirectorsDirty || RedirectorSweptFolderPaths != SelectedFolderPaths;
+
+	if (!bSweepSelectedFolders && PendingRedirectorPackages.IsEmpty()) return;
+
+	TArray<FAssetData> AssetList;
+
+	// Redirectors created by plugin renames; their referencers can be anywhere in the project
+	if (!PendingRedirectorPackages.IsEmpty())
+	{
+		FARFilter PendingFilter;
+		PendingFilter.PackageNames = PendingRedirectorPackages.Array();
+		PendingFilter.ClassPaths.Add(UObjectRedirector::StaticClass()->GetClassPathName());
+
+		Catalog->GetAssets(PendingFilter, AssetList);
+		PendingRedirectorPackages.Empty();
+	}
+
+	// Redirectors under the selected folders
+	if (bSweepSelectedFolders && !SelectedFolderPaths.IsEmpty())
+	{
+		FARFilter FolderFilter;
+		FolderFilter.bRecursivePaths = true;
+		FolderFilter.ClassPaths.Add(UObjectRedirector::StaticClass()->GetClassPathName());
+
+		for (const FString& SelectedFolderPath : SelectedFolderPaths)
+		{
+			FolderFilter.PackagePaths.Emplace(*SelectedFolderPath);
+		}
+
+		TArray<FAssetData> FolderRedirectors;
+		Catalog->GetAssets(FolderFilter, FolderRedirectors);
+
+		// Skip redirectors already found through the pending query
+		TSet<FName> ListedPackages;
+		ListedPackages.Reserve(AssetList.Num() + FolderRedirectors.Num());
+
+		for (const FAssetData& PendingRedirector : AssetList)
+		{
+			ListedPackages.Add(PendingRedirector.PackageName);
+		}
+
+		for (FAssetData& FolderRedirector : FolderRedirectors)
+		{
+			bool bAlreadyListed = false;
+			ListedPackages.Add(FolderRedirector.PackageName, &bAlreadyListed);
+
+			if (!bAlreadyListed)
+			{
+				AssetList.Add(MoveTemp(FolderRedirector));
+			}
+		}
+	}
+
+	RedirectorSweptFolderPaths = SelectedFolderPaths;
+	bFolderRedirectorsDirty = false;
+
+	Catalog->FixupRedirectors(AssetList);
+}
+
+TBitArray<> FAssetActionsManagerModule::FilterAssetTable(EAssetActionsFilter Filter, const TBitArray<>& RowsToFilter)
+/*
+	Dispatch to the filter fn for the filter passed in; the All filter passes every live row
+*/
+{
+	ASSET_ACTIONS_COUNT(AssetsFiltered, RowsToFilter.CountSetBits());
+
+	switch (Filter)
+	{
+	case EAssetActionsFilter::Unused:
+		return FilterForUnusedAssetData(RowsToFilter);
+
+	case EAssetActionsFilter::DuplicateName:
+		return FilterForDuplicateNameData(RowsToFilter);
+
+	case EAssetActionsFilter::NamingViolation:
+		return FilterForNamingViolations(RowsToFilter);
+
+	default:
+		break;
+	}
+
+	TBitArray<> PassedRows(false, AssetTable.GetMaxRows());
+
+	for (TConstSetBitIterator<> It(RowsToFilter); It; ++It)
+	{
+		PassedRows[It.GetIndex()] = AssetTable.IsValidRow(It.GetIndex());
+	}
+
+	return PassedRows;
+}
+
+TBitArray<> FAssetActionsManagerModule::FilterAssetTableRows(EAssetActionsFilter Filter, const TArray<int32>& RowsToFilter)
+/*
+	Same checks as the bitset filters, one row at a time: a row is a duplicate if another row shares its name, 
+	and referencers are only queried for the packages of the rows passed in
+*/
+{
+	ASSET_ACTIONS_COUNT(AssetsFiltered, RowsToFilter.Num());
+
+	const bool bReachabilityBased = Filter == EAssetActionsFilter::Unused && IsUnusedFilterReachabilityBased();
+	const FAssetActionsReachability* ReachablePackages = bReachabilityBased ? &GetReachability() : nullptr;
+	const bool bCaseSensitive = CVarCaseSensitiveDuplicateNames.GetValueOnGameThread();
+
+	TBitArray<> PassedRows(false, RowsToFilter.Num());
+	TArray<int32> RowsWithName;
+
+	for (int32 Index = 0; Index < RowsToFilter.Num(); ++Index)
+	{
+		const int32 Row = RowsToFilter[Index];
+
+		if (!AssetTable.IsValidRow(Row)) continue;
+
+		switch (Filter)
+		{
+		case EAssetActionsFilter::Unused:
+			if (ReachablePackages)
+			{
+				PassedRows[Index] = !ReachablePackages->IsReachable(AssetTable.GetPackageName(Row));
+			}
+
+			// Skip level maps
+			else if (AssetTable.GetAssetClassName(Row) != NAME_World)
+			{
+				PassedRows[Index] = FindOrQueryReferencers(AssetTable.GetPackageName(Row)).IsEmpty();
+			}
+			break;
+
+		case EAssetActionsFilter::DuplicateName:
+		{
+			const FName& AssetName = AssetTable.GetAssetName(Row);
+
+			RowsWithName.Reset();
+			AssetTable.FindRowsByAssetName(AssetName, RowsWithName);
+
+			// Rows found by name match case-insensitively; the case-sensitive mode also needs the same casing
+			PassedRows[Index] = Algo::CountIf(RowsWithName, [this, &AssetName, bCaseSensitive](int32 RowWithName)
+				{
+					return !bCaseSensitive || AssetTable.GetAssetName(RowWithName).GetDisplayIndex() == AssetName.GetDisplayIndex();
+				}) > 1;
+			break;
+		}
+
+		case EAssetActionsFilter::NamingViolation:
+			// skip maps
+			PassedRows[Index] = AssetTable.GetAssetClassName(Row) != NAME_World && GetNamingViolations(Row) != EAssetNamingViolation::None;
+			break;
+
+		default:
+			PassedRows[Index] = true;
+			break;
+		}
+	}
+
+	return PassedRows;
+}
+
+TBitArray<> FAssetActionsManagerModule::FilterForUnusedAssetData(const TBitArray<>& RowsToFilter)
+/*
+	Return a bitset of unused assets by checking count of asset referencers for the rows passed in 
+*/
+{
+	if (IsUnusedFilterReachabilityBased())
+	{
+		return FilterForUnreachableAssetData(RowsToFilter);
+	}
+
+	ASSET_ACTIONS_SCOPE(FilterForUnused);
+
+	// Fill the cache first so rows can be checked on worker threads without writing to it
+	CacheAssetReferencersCounts(RowsToFilter);
+
+	return AssetActionsParallel::FilterRows(AssetTable, RowsToFilter, [this](int32 Row)
+		{
+			// Skip level maps
+			if (AssetTable.GetAssetClassName(Row) == NAME_World) return false;
+
+			return CachedReferencers.FindChecked(AssetTable.GetPackageName(Row)).IsEmpty();
+		});
+}
+
+TBitArray<> FAssetActionsManagerModule::FilterForUnreachableAssetData(const TBitArray<>& RowsToFilter)
+/*
+	Return a bitset of the rows whose package was not marked from the roots. Marking is shared by every 
+	filter run until something changes, so filtering itself is one set lookup per row.
+*/
+{
+	const FAssetActionsReachability& ReachablePackages = GetReachability();
+
+	ASSET_ACTIONS_SCOPE(FilterForUnreachable);
+
+	return AssetActionsParallel::FilterRows(AssetTable, RowsToFilter, [this, &ReachablePackages](int32 Row)
+		{
+			return !ReachablePackages.IsReachable(AssetTable.GetPackageName(Row));
+		});
+}
+
+bool FAssetActionsManagerModule::IsUnusedFilterReachabilityBased() const
+{
+	return GetDefault<UAssetActionsUnusedSettings>()->Detection == EAssetActionsUnusedDetection::Reachability;
+}
+
+TBitArray<> FAssetActionsManagerModule::FilterForDuplicateNameData(const TBitArray<>& RowsToFilter)
+/*
+	Return a bitset of duplicate name assets. A row's duplicates can only be rows with the same 
+	case-insensitive name, so only those rows are grouped rather than the whole table.
+*/
+{
+	ASSET_ACTIONS_SCOPE(FilterForDuplicateName);
+
+	TBitArray<> DuplicatedRows(false, AssetTable.GetMaxRows());
+
+	// Widen the rows to every row that shares a name with one of them
+	TSet<FName> NamesToGroup;
+
+	for (TConstSetBitIterator<> It(RowsToFilter); It; ++It)
+	{
+		if (!AssetTable.IsValidRow(It.GetIndex())) continue;
+
+		NamesToGroup.Add(AssetTable.GetAssetName(It.GetIndex()));
+	}
+
+	TBitArray<> RowsToGroup(false, AssetTable.GetMaxRows());
+	TArray<int32> RowsWithName;
+
+	for (const FName& NameToGroup : NamesToGroup)
+	{
+		// Unique names can't be duplicates
+		if (AssetTable.NumRowsWithAssetName(NameToGroup) <= 1) continue;
+
+		RowsWithName.Reset();
+		AssetTable.FindRowsByAssetName(NameToGroup, RowsWithName);
+
+		for (const int32 RowWithName : RowsWithName)
+		{
+			RowsToGroup[RowWithName] = true;
+		}
+	}
+
+	for (const TArray<int32>& DuplicateGroup : GroupDuplicateNames(RowsToGroup))
+	{
+		for (const int32 Row : DuplicateGroup)
+		{
+			if (RowsToFilter.IsValidIndex(Row) && RowsToFilter[Row])
+			{
+				DuplicatedRows[Row] = true;
+			}
+		}
+	}
+
+	return DuplicatedRows;
+}
+
+TArray<TArray<int32>> FAssetActionsManagerModule::GroupDuplicateNames(const TBitArray<>& Rows) const
+/*
+	Group rows by asset name with one hash pass per chunk of rows on worker threads, then merge the chunk groups 
+	in chunk order so groups and their rows come out in row order as a serial pass would. Names are keyed on 
+	their FName index and number, so no string is built or compared: the comparison index matches names 
+	case-insensitively and the display index (case-sensitive mode) only matches names with identical casing.
+*/
+{
+	const bool bCaseSensitive = CVarCaseSensitiveDuplicateNames.GetValueOnGameThread();
+
+	const TArray<int32> RowsToGroup = AssetActionsParallel::GatherRows(AssetTable, Rows);
+	const int32 NumChunks = AssetActionsParallel::GetNumChunks(RowsToGroup.Num());
+
+	/** Groups found in one chunk, in order of the first row of each name */
+	struct FChunkGroups
+	{
+		TMap<uint64, int32> GroupIndexByName;
+		TArray<TPair<uint64, TArray<int32>>> Groups;
+	};
+
+	TArray<FChunkGroups> GroupsByChunk;
+	GroupsByChunk.SetNum(NumChunks);
+
+	AssetActionsParallel::ForEachChunk(RowsToGroup.Num(), NumChunks,
+		[this, bCaseSensitive, &RowsToGroup, &GroupsByChunk](int32 ChunkIndex, int32 Begin, int32 End)
+		{
+			FChunkGroups& ChunkGroups = GroupsByChunk[ChunkIndex];
+
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				const int32 Row = RowsToGroup[Index];
+
+				const FName& AssetName = AssetTable.GetAssetName(Row);
+				const FNameEntryId NameIndex = bCaseSensitive ? AssetName.GetDisplayIndex() : AssetName.GetComparisonIndex();
+				const uint64 NameKey = (static_cast<uint64>(NameIndex.ToUnstableInt()) << 32) | static_cast<uint32>(AssetName.GetNumber());
+
+				int32& GroupIndex = ChunkGroups.GroupIndexByName.FindOrAdd(NameKey, INDEX_NONE);
+
+				if (GroupIndex == INDEX_NONE)
+				{
+					GroupIndex = ChunkGroups.Groups.Emplace(NameKey, TArray<int32>());
+				}
+
+				ChunkGroups.Groups[GroupIndex].Value.Add(Row);
+			}
+		});
+
+	TMap<uint64, int32> GroupIndexByName;
+	TArray<TArray<int32>> Groups;
+
+	for (FChunkGroups& ChunkGroups : GroupsByChunk)
+	{
+		for (TPair<uint64, TArray<int32>>& ChunkGroup : ChunkGroups.Groups)
+		{
+			int32& GroupIndex = GroupIndexByName.FindOrAdd(ChunkGroup.Key, INDEX_NONE);
+
+			if (GroupIndex == INDEX_NONE)
+			{
+				GroupIndex = Groups.Add(MoveTemp(ChunkGroup.Value));
+			}
+
+			else
+			{
+				Groups[GroupIndex].Append(ChunkGroup.Value);
+			}
+		}
+	}
+
+	Groups.RemoveAll([](const TArray<int32>& Group) { return Group.Num() <= 1; });
+
+	return Groups;
+}
+
+int32 FAssetActionsManagerModule::CompareDuplicateNames(const FName& A, const FName& B) const
+/*
+	FName compares ignore casing, so casing only breaks ties in the case-sensitive mode
+*/
+{
+	const int32 Result = A.Compare(B);
+
+	if (Result != 0 || !CVarCaseSensitiveDuplicateNames.GetValueOnGameThread()) return Result;
+
+	return A.ToString().Compare(B.ToString(), ESearchCase::CaseSensitive);
+}
+
+TBitArray<> FAssetActionsManagerModule::FilterForNamingViolations(const TBitArray<>& RowsToFilter)
+/*
+	Return a bitset of assets whose names break a naming rule for their class and folder: a missing prefix or 
+	suffix, or a forbidden substring
+*/
+{
+	ASSET_ACTIONS_SCOPE(FilterForNamingViolations);
+
+	FAssetNamingRules& Rules = GetNamingRules();
+
+	// Resolving can query the catalog and fills the rule caches, so it runs here before the names are checked
+	TBitArray<> RowsToCheck(false, AssetTable.GetMaxRows());
+
+	for (TConstSetBitIterator<> It(RowsToFilter); It; ++It)
+	{
+		const int32 Row = It.GetIndex();
+
+		if (!AssetTable.IsValidRow(Row)) continue;
+
+		const FTopLevelAssetPath& AssetClassPath = AssetTable.GetAssetClassPath(Row);
+
+		// skip maps
+		if (AssetClassPath.GetAssetName() == NAME_World) { continue; }
+
+		Rules.Resolve(AssetClassPath, AssetTable.GetPackagePath(Row));
+		RowsToCheck[Row] = true;
+	}
+
+	const FAssetNamingRules& ResolvedRules = Rules;
+
+	return AssetActionsParallel::FilterRows(AssetTable, RowsToCheck, [this, &ResolvedRules](int32 Row)
+		{
+			return ResolvedRules.CheckResolvedName(AssetTable.GetAssetName(Row), AssetTable.GetAssetClassPath(Row), 
+				AssetTable.GetPackagePath(Row)) != EAssetNamingViolation::None;
+		});
+}
+
+EAssetNamingViolation FAssetActionsManagerModule::GetNamingViolations(int32 Row)
+{
+	if (!AssetTable.IsValidRow(Row)) return EAssetNamingViolation::None;
+
+	return GetNamingRules().CheckName(AssetTable.GetAssetName(Row), AssetTable.GetAssetClassPath(Row), AssetTable.GetPackagePath(Row));
+}
+
+bool FAssetActionsManagerModule::DeleteAssetsInList(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation, 
+	TArray<FAssetData>* OutSkippedAssets)
+/*
+	Return true if assets were successfully deleted; else return false. Skipped assets are found with one catalog 
+	query for the packages of the list, since deleted assets leave the catalog before the delete returns.
+*/
+{
+	const bool bDeletedAssets = Catalog->DeleteAssets(AssetsToDelete, bShowConfirmation) > 0;
+
+	if (OutSkippedAssets && !AssetsToDelete.IsEmpty())
+	{
+		TSet<FName> PackagesToDelete;
+		PackagesToDelete.Reserve(AssetsToDelete.Num());
+
+		for (const FAssetData& AssetToDelete : AssetsToDelete)
+		{
+			PackagesToDelete.Add(AssetToDelete.PackageName);
+		}
+
+		FARFilter RemainingFilter;
+		RemainingFilter.PackageNames = PackagesToDelete.Array();
+
+		TArray<FAssetData> RemainingAssets;
+		Catalog->GetAssets(RemainingFilter, RemainingAssets);
+
+		TSet<FSoftObjectPath> RemainingAssetPaths;
+
+		for (const FAssetData& RemainingAsset : RemainingAssets)
+		{
+			RemainingAssetPaths.Add(RemainingAsset.GetSoftObjectPath());
+		}
+
+		for (const FAssetData& AssetToDelete : AssetsToDelete)
+		{
+			if (RemainingAssetPaths.Contains(AssetToDelete.GetSoftObjectPath()))
+			{
+				OutSkippedAssets->Add(AssetToDelete);
+			}
+		}
+	}
+
+	return bDeletedAssets;
+}
+
+bool FAssetActionsManagerModule::OrderAssetsForChunkedDeletion(TArray<TSharedPtr<FAssetData>>& AssetsToDelete)
+/*
+	Topological order over the listed packages: a package is emitted once every listed package referencing it 
+	has been emitted, so a chunk never holds an asset whose referencer is still waiting in a later chunk. 
+	Packages left over after the sort are on a cycle.
+*/
+{
+	TMap<FName, TArray<int32>> AssetIndicesByPackage;
+
+	for (int32 AssetIndex = 0; AssetIndex < AssetsToDelete.Num(); ++AssetIndex)
+	{
+		AssetIndicesByPackage.FindOrAdd(AssetsToDelete[AssetIndex]->PackageName).Add(AssetIndex);
+	}
+
+	TMap<FName, int32> NumReferencersLeft;
+	TMap<FName, TArray<FName>> ListedDependencies;
+
+	for (const TPair<FName, TArray<int32>>& Package : AssetIndicesByPackage)
+	{
+		int32& NumReferencers = NumReferencersLeft.Add(Package.Key, 0);
+
+		for (const FName& Referencer : FindOrQueryReferencers(Package.Key))
+		{
+			if (Referencer == Package.Key) continue;
+
+			// Referenced from outside the list
+			if (!AssetIndicesByPackage.Contains(Referencer)) return false;
+
+			ListedDependencies.FindOrAdd(Referencer).Add(Package.Key);
+			++NumReferencers;
+		}
+	}
+
+	TArray<FName> PackagesToEmit;
+
+	for (const TPair<FName, int32>& NumReferencers : NumReferencersLeft)
+	{
+		if (NumReferencers.Value == 0)
+		{
+			PackagesToEmit.Add(NumReferencers.Key);
+		}
+	}
+
+	TArray<TSharedPtr<FAssetData>> OrderedAssets;
+	OrderedAssets.Reserve(AssetsToDelete.Num());
+
+	for (int32 EmitIndex = 0; EmitIndex < PackagesToEmit.Num(); ++EmitIndex)
+	{
+		// Copied since adding to the list may reallocate it
+		const FName PackageName = PackagesToEmit[EmitIndex];
+
+		for (const int32 AssetIndex : AssetIndicesByPackage.FindChecked(PackageName))
+		{
+			OrderedAssets.Add(AssetsToDelete[AssetIndex]);
+		}
+
+		if (const TArray<FName>* Dependencies = ListedDependencies.Find(PackageName))
+		{
+			for (const FName& Dependency : *Dependencies)
+			{
+				if (--NumReferencersLeft.FindChecked(Dependency) == 0)
+				{
+					PackagesToEmit.Add(Dependency);
+				}
+			}
+		}
+	}
+
+	if (OrderedAssets.Num() != AssetsToDelete.Num()) return false;
+
+	AssetsToDelete = MoveTemp(OrderedAssets);
+
+	return true;
+}
+
+bool FAssetActionsManagerModule::RenameAssetInList(const FString& NewName, const TSharedPtr<FAssetData>& AssetToRename)
+/*
+	Return true if assets were successfully renamed; else return false
+*/
+{
+	TArray<TPair<TSharedPtr<FAssetData>, FString>> AssetsAndNewNames;
+	AssetsAndNewNames.Emplace(AssetToRename, NewName);
+
+	return RenameAssetsInBatch(AssetsAndNewNames) > 0;
+}
+
+bool FAssetActionsManagerModule::DuplicateAssetsInList(int32 NumOfDuplicates, const TArray<TSharedPtr<FAssetData>>& AssetsToDuplicate)
+/*
+	Return true if assets were successfully duplicated; else return false
+*/
+{
+	if (NumOfDuplicates <= 0) { return false; }
+
+	// Existing names are gathered once for the whole batch; each duplicate reserves its name
+	FAssetNameReservations NameReservations = BuildNameReservations(AssetsToDuplicate);
+
+	TArray<TPair<FAssetData, FString>> SourcesAndNewPackageNames;
+	SourcesAndNewPackageNames.Reserve(AssetsToDuplicate.Num() * NumOfDuplicates);
+
+	for (const TSharedPtr<FAssetData>& AssetToDuplicate : AssetsToDuplicate)
+	{
+		for (int32 i = 0; i < NumOfDuplicates; ++i)
+		{
+			const FString DuplicatedAssetName = 
+				NameReservations.Reserve(AssetToDuplicate->PackagePath, AssetToDuplicate->AssetName.ToString());
+
+			const FString NewAssetPath = FPaths::Combine(AssetToDuplicate->PackagePath.ToString(), DuplicatedAssetName);
+
+			SourcesAndNewPackageNames.Emplace(*AssetToDuplicate, NewAssetPath);
+		}
+	}
+
+	// The catalog saves every new package in one stage
+	if (Catalog->DuplicateAssets(SourcesAndNewPackageNames) > 0)
+	{
+		return true;
 	}
 	
 	return false;
 }
 
+FAssetActionsManagerModule::FAssetNameReservations FAssetActionsManagerModule::BuildNameReservations(
+	const TArray<TSharedPtr<FAssetData>>& AssetsToName) const
+/*
+	Query the catalog once for every package in the folders the assets live in; 
+	redirectors are included since they also occupy a package name
+*/
+{
+	FAssetNameReservations NameReservations;
+
+	TSet<FName> PackagePaths;
+
+	for (const TSharedPtr<FAssetData>& AssetToName : AssetsToName)
+	{
+		PackagePaths.Add(AssetToName->PackagePath);
+	}
+
+	FARFilter Filter;
+	Filter.bIncludeOnlyOnDiskAssets = false;
+	Filter.PackagePaths = PackagePaths.Array();
+
+	if (Filter.PackagePaths.IsEmpty()) return NameReservations;
+
+	TArray<FAssetData> AssetList;
+	Catalog->GetAssets(Filter, AssetList);
+
+	NameReservations.ReservedPackageNames.Reserve(AssetList.Num());
+
+	for (const FAssetData& Asset : AssetList)
+	{
+		NameReservations.ReservedPackageNames.Add(Asset.PackageName);
+	}
+
+	return NameReservations;
+}
+
+FString FAssetActionsManagerModule::FAssetNameReservations::Reserve(const FName& PackagePath, const FString& BaseName)
+/*
+	Append the next free number to BaseName. The next number to try is remembered per folder and base name, 
+	so every number is tested at most once across the batch.
+*/
+{
+	const FString BasePackageName = PackagePath.ToString() / BaseName;
+	int32& NextSuffix = NextSuffixByBaseName.FindOrAdd(BasePackageName, 1);
+
+	FString ReservedName;
+	FName ReservedPackageName;
+
+	do
+	{
+		const FString Suffix = FString::FromInt(NextSuffix++);
+		ReservedName = BaseName + Suffix;
+		ReservedPackageName = FName(BasePackageName + Suffix);
+	} 
+	while (ReservedPackageNames.Contains(ReservedPackageName));
+
+	ReservedPackageNames.Add(ReservedPackageName);
+
+	return ReservedName;
+}
+
+bool FAssetActionsManagerModule::AddPrefixesToAssetsInList(const TArray<TSharedPtr<FAssetData>>& AssetsToAddPrefixes)
+/*
+	Return true if prefixes were successfully added to asset names; else return false
+*/
+{
+	TArray<TPair<TSharedPtr<FAssetData>, FString>> AssetsAndNewNames;
+	AssetsAndNewNames.Reserve(AssetsToAddPrefixes.Num());
+
+	for (const TSharedPtr<FAssetData>& Asset : AssetsToAddPrefixes)
+	{
+		const FName AssetClassName = Asset->AssetClassPath.GetAssetName();
+		FString OldName = Asset->AssetName.ToString();
+
+		// skip maps
+		if (AssetClassName == NAME_World) { continue; }
+
+		const FString* PrefixFound = GetNamingRules().FindPrefix(Asset->AssetClassPath, Asset->PackagePath);
+
+		if (!PrefixFound)
+		{
+			DebugHelper::PrintLog("No prefix found for asset: " + OldName);
+			continue;
+		}
+
+		if (OldName.StartsWith(*PrefixFound))
+		{
+			DebugHelper::PrintLog(OldName + " already has prefix added");
+			continue;
+		}
+
+		// Remove Unreal default _Inst for Material Instances
+		if (AssetClassName == TEXT("MaterialInstanceConstant"))
+		{
+			if (OldName.Contains(TEXT("_Inst")))
+			{
+
+				TArray<FString> NameArray;
+				OldName.ParseIntoArray(NameArray, TEXT("_Inst"));
+
+				OldName.Empty();
+
+				for (FString Name : NameArray)
+				{
+					OldName.Append(Name);
+				}
+			}
+
+			OldName.RemoveFromStart(TEXT("M_"));
+		}
+
+		AssetsAndNewNames.Emplace(Asset, *PrefixFound + OldName);
+	}
+
+	return RenameAssetsInBatch(AssetsAndNewNames) > 0;
+}
+
+bool FAssetActionsManagerModule::ReplaceString(const FString& OldString, const FString& NewString, const TArray<TSharedPtr<FAssetData>>& AssetsToReplace)
+/*
+	Return true if user entered string to replace was successfully replaced with new string; else return false
+*/
+{
+	TArray<TPair<TSharedPtr<FAssetData>, FString>> AssetsAndNewNames;
+
+	for (const TSharedPtr<FAssetData>& Asset : AssetsToReplace)
+	{
+		const FString OldAssetName = Asset->AssetName.ToString();
+
+		if (OldAssetName.Contains(OldString, ESearchCase::CaseSensitive))
+		{
+			AssetsAndNewNames.Emplace(Asset, OldAssetName.Replace(*OldString, *NewString, ESearchCase::CaseSensitive));
+		}
+	}
+
+	return RenameAssetsInBatch(AssetsAndNewNames) > 0;
+}
+
+#pragma endregion
+
+#pragma region BatchRename
+
+int32 FAssetActionsManagerModule::RenameAssetsInBatch(const TArray<TPair<TSharedPtr<FAssetData>, FString>>& AssetsAndNewNames)
+/*
+	Submit every rename to the catalog at once so referencers are fixed up in a single pass and every package 
+	the renames changed is saved together. Renamed packages may have left a redirector behind.
+*/
+{
+	TArray<TPair<FSoftObjectPath, FSoftObjectPath>> ObjectPathRenames;
+	ObjectPathRenames.Reserve(AssetsAndNewNames.Num());
+
+	for (const TPair<TSharedPtr<FAssetData>, FString>& AssetAndNewName : AssetsAndNewNames)
+	{
+		const FAssetData& Asset = *AssetAndNewName.Key;
+		const FString& NewName = AssetAndNewName.Value;
+
+		if (NewName.IsEmpty() || NewName == Asset.AssetName.ToString()) continue;
+
+		const FString NewPackageName = FPaths::Combine(Asset.PackagePath.ToString(), NewName);
+		ObjectPathRenames.Emplace(Asset.GetSoftObjectPath(), FSoftObjectPath(NewPackageName + TEXT(".") + NewName));
+	}
+
+	if (ObjectPathRenames.IsEmpty()) return 0;
+
+	TArray<FSoftObjectPath> RenamedObjectPaths;
+	Catalog->RenameAssets(ObjectPathRenames, RenamedObjectPaths);
+
+	for (const FSoftObjectPath& RenamedObjectPath : RenamedObjectPaths)
+	{
+		PendingRedirectorPackages.Add(RenamedObjectPath.GetLongPackageFName());
+	}
+
+	return RenamedObjectPaths.Num();
+}
+
+#pragma endregion
+
+#pragma region NamingRules
+
+FAssetNamingRules& FAssetActionsManagerModule::GetNamingRules()
+/*
+	Compile the naming rules on first use and after the settings change, so an edit in Project Settings applies 
+	to the next filter run or prefix action
+*/
+{
+	if (bNamingRulesDirty)
+	{
+		NamingRules.Compile(*GetDefault<UAssetActionsNamingSettings>());
+		bNamingRulesDirty = false;
+	}
+
+	return NamingRules;
+}
+
+void FAssetActionsManagerModule::OnNamingSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+/*
+	The tab's naming violation result was computed with the old rules, so tell it to filter again
+*/
+{
+	bNamingRulesDirty = true;
+
+	FAssetActionsDelta Delta;
+	Delta.bFilterSettingsChanged = true;
+	AssetDataChangedEvent.Broadcast(Delta);
+}
+
+#pragma endregion
+
+#pragma region Reachability
+
+const FAssetActionsReachability& FAssetActionsManagerModule::GetReachability()
+/*
+	Gather the roots and mark the graph on first use and after the unused settings changed. Marks gone stale after
+	a lost reference are rebuilt the same way, but compared with the previous marks so the widget is only told 
+	about the packages that changed.
+*/
+{
+	if (bReachabilityDirty || bReachabilityStale)
+	{
+		TArray<FName> RootPackages;
+		FAssetActionsReachability::GatherRootPackages(*Catalog, *GetDefault<UAssetActionsUnusedSettings>(), RootPackages);
+
+		if (bReachabilityDirty)
+		{
+			ReachabilityChangedPackages.Reset();
+		}
+
+		Reachability.Build(*Catalog, RootPackages, bReachabilityDirty ? nullptr : &ReachabilityChangedPackages);
+		bReachabilityDirty = false;
+		bReachabilityStale = false;
+	}
+
+	return Reachability;
+}
+
+void FAssetActionsManagerModule::TakeReachabilityChanges(TArray<FName>& OutChangedPackages)
+{
+	if (bReachabilityStale && !bReachabilityDirty)
+	{
+		GetReachability();
+	}
+
+	OutChangedPackages.Append(ReachabilityChangedPackages.Array());
+	ReachabilityChangedPackages.Reset();
+}
+
+bool FAssetActionsManagerModule::CanUpdateReachability()
+/*
+	Marks that were never built, or are built from scratch on next use, need no update; the widget refilters 
+	everything after a full build
+*/
+{
+	if (bReachabilityDirty || !IsUnusedFilterReachabilityBased())
+	{
+		bReachabilityDirty = true;
+		return false;
+	}
+
+	return true;
+}
+
+void FAssetActionsManagerModule::UpdateReachabilityForRemovedPackage(const FName& PackageName, FAssetActionsDelta& OutDelta)
+{
+	if (!CanUpdateReachability()) return;
+
+	if (bReachabilityStale || Reachability.IsReachable(PackageName))
+	{
+		bReachabilityStale = true;
+		OutDelta.bReachabilityChanged = true;
+	}
+}
+
+void FAssetActionsManagerModule::UpdateReachabilityForChangedAsset(const FAssetData& AssetData, FAssetActionsDelta& OutDelta)
+/*
+	One dependency query for a reached package or a new root; every other asset change returns after a lookup
+*/
+{
+	if (!CanUpdateReachability()) return;
+
+	// A rebuild is pending and will see this change too
+	if (bReachabilityStale)
+	{
+		OutDelta.bReachabilityChanged = true;
+		return;
+	}
+
+	const bool bReached = Reachability.IsReachable(AssetData.PackageName);
+
+	if (!bReached && !FAssetActionsReachability::IsRootAsset(AssetData, *GetDefault<UAssetActionsUnusedSettings>())) return;
+
+	TArray<FName> Dependencies;
+	Catalog->GetDependencies(AssetData.PackageName, Dependencies);
+
+	if (bReached && Reachability.LosesDependencies(AssetData.PackageName, Dependencies))
+	{
+		bReachabilityStale = true;
+		OutDelta.bReachabilityChanged = true;
+		return;
+	}
+
+	TSet<FName> NewlyReached;
+	Reachability.MarkFrom(*Catalog, AssetData.PackageName, MoveTemp(Dependencies), NewlyReached);
+
+	if (!NewlyReached.IsEmpty())
+	{
+		ReachabilityChangedPackages.Append(NewlyReached);
+		OutDelta.bReachabilityChanged = true;
+	}
+}
+
+void FAssetActionsManagerModule::OnUnusedSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+/*
+	A new detection mode or new roots can change the result for every row, so the tab filters again rather than 
+	waiting for a list of changed packages
+*/
+{
+	bReachabilityDirty = true;
+	bReachabilityStale = false;
+	ReachabilityChangedPackages.Reset();
+
+	FAssetActionsDelta Delta;
+	Delta.bFilterSettingsChanged = true;
+	AssetDataChangedEvent.Broadcast(Delta);
+}
+
+#pragma endregion
+
+#pragma region ReferencerCache
+
+void FAssetActionsManagerModule::BindCatalogEvents()
+/*
+	Bind to catalog events so cached referencer counts are invalidated per package when assets change
+*/
+{
+	AssetAddedHandle = Catalog->OnAssetAdded().AddRaw(this, &FAssetActionsManagerModule::OnAssetAdded);
+	AssetRemovedHandle = Catalog->OnAssetRemoved().AddRaw(this, &FAssetActionsManagerModule::OnAssetRemoved);
+	AssetRenamedHandle = Catalog->OnAssetRenamed().AddRaw(this, &FAssetActionsManagerModule::OnAssetRenamed);
+	AssetUpdatedHandle = Catalog->OnAssetUpdated().AddRaw(this, &FAssetActionsManagerModule::OnAssetUpdated);
+}
+
+void FAssetActionsManagerModule::UnbindCatalogEvents()
+{
+	if (!Catalog.IsValid()) return;
+
+	Catalog->OnAssetAdded().Remove(AssetAddedHandle);
+	Catalog->OnAssetRemoved().Remove(AssetRemovedHandle);
+	Catalog->OnAssetRenamed().Remove(AssetRenamedHandle);
+	Catalog->OnAssetUpdated().Remove(AssetUpdatedHandle);
+}
+
+const TArray<FName>& FAssetActionsManagerModule::FindOrQueryReferencers(const FName& PackageName)
+/*
+	Return the cached referencers for a package. On a cache miss, or the first read of a list taken from the 
+	audit cache, query the catalog once and record the result in both the cache and the reverse lookup used 
+	for invalidation.
+*/
+{
+	if (const TArray<FName>* FoundReferencers = CachedReferencers.Find(PackageName))
+	{
+		if (!UnverifiedCachedReferencers.Contains(PackageName)) return *FoundReferencers;
+
+		RemoveCachedReferencers(PackageName);
+	}
+
+	TArray<FName> Referencers;
+	Catalog->GetReferencers(PackageName, Referencers);
+
+	return AddCachedReferencers(PackageName, MoveTemp(Referencers));
+}
+
+const TArray<FName>& FAssetActionsManagerModule::AddCachedReferencers(const FName& PackageName, TArray<FName>&& Referencers)
+{
+	for (const FName& Referencer : Referencers)
+	{
+		CachedPackagesByReferencer.Add(Referencer, PackageName);
+	}
+
+	return CachedReferencers.Add(PackageName, MoveTemp(Referencers));
+}
+
+bool FAssetActionsManagerModule::RemoveCachedReferencers(const FName& PackageName)
+/*
+	Remove a single package from the cache along with its entries in the reverse lookup
+*/
+{
+	TArray<FName> Referencers;
+
+	UnverifiedCachedReferencers.Remove(PackageName);
+
+	if (!CachedReferencers.RemoveAndCopyValue(PackageName, Referencers)) return false;
+
+	for (const FName& Referencer : Referencers)
+	{
+		CachedPackagesByReferencer.RemoveSingle(Referencer, PackageName);
+	}
+
+	return true;
+}
+
+void FAssetActionsManagerModule::InvalidateReferencersForPackage(const FName& PackageName, TArray<FName>& OutInvalidatedPackages)
+/*
+	A change to PackageName can only change the referencer counts of packages it referenced before the 
+	change (found through the reverse lookup) or references after it (found through its dependencies).
+	Invalidate exactly those entries plus the package itself.
+*/
+{
+	// Nothing has been cached yet, e.g. during the initial asset registry scan
+	if (CachedReferencers.IsEmpty()) return;
+
+	TArray<FName> PackagesToInvalidate;
+	PackagesToInvalidate.Add(PackageName);
+
+	// Packages that listed PackageName as a referencer before the change
+	CachedPackagesByReferencer.MultiFind(PackageName, PackagesToInvalidate);
+
+	// Packages that PackageName references after the change
+	TArray<FName> Dependencies;
+	Catalog->GetDependencies(PackageName, Dependencies);
+	PackagesToInvalidate.Append(Dependencies);
+
+	for (const FName& PackageToInvalidate : PackagesToInvalidate)
+	{
+		if (RemoveCachedReferencers(PackageToInvalidate))
+		{
+			OutInvalidatedPackages.Add(PackageToInvalidate);
+		}
+	}
+}
+
+void FAssetActionsManagerModule::OnAssetAdded(const FAssetData& AssetData)
+{
+	// A redirector created under the swept folders by anything other than the plugin requires a new sweep
+	if (AssetData.IsRedirector() && IsPackagePathInFolders(AssetData.PackagePath, RedirectorSweptFolderPaths))
+	{
+		bFolderRedirectorsDirty = true;
+	}
+
+	FAssetActionsDelta Delta;
+	InvalidateReferencersForPackage(AssetData.PackageName, Delta.ReferencersChangedPackages);
+	UpdateReachabilityForChangedAsset(AssetData, Delta);
+
+	// Only build the delta when a widget is listening; this also fires for every asset in the initial scan
+	if (!AssetDataChangedEvent.IsBound())
+	{
+		ReachabilityChangedPackages.Reset();
+		return;
+	}
+
+	if (!AssetData.IsRedirector())
+	{
+		Delta.AddedAssets.Add(AssetData);
+	}
+
+	AssetDataChangedEvent.Broadcast(Delta);
+}
+
+void FAssetActionsManagerModule::OnAssetRemoved(const FAssetData& AssetData)
+{
+	FAssetActionsDelta Delta;
+	InvalidateReferencersForPackage(AssetData.PackageName, Delta.ReferencersChangedPackages);
+	UpdateReachabilityForRemovedPackage(AssetData.PackageName, Delta);
+
+	if (!AssetDataChangedEvent.IsBound())
+	{
+		ReachabilityChangedPackages.Reset();
+		return;
+	}
+
+	Delta.RemovedAssets.Add(AssetData.GetSoftObjectPath());
+	AssetDataChangedEvent.Broadcast(Delta);
+}
+
+void FAssetActionsManagerModule::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+/*
+	A rename removes the old package and adds a new one, so invalidate both
+*/
+{
+	const FSoftObjectPath OldSoftObjectPath(OldObjectPath);
+
+	FAssetActionsDelta Delta;
+	InvalidateReferencersForPackage(OldSoftObjectPath.GetLongPackageFName(), Delta.ReferencersChangedPackages);
+	InvalidateReferencersForPackage(AssetData.PackageName, Delta.ReferencersChangedPackages);
+	UpdateReachabilityForRemovedPackage(OldSoftObjectPath.GetLongPackageFName(), Delta);
+	UpdateReachabilityForChangedAsset(AssetData, Delta);
+
+	if (!AssetDataChangedEvent.IsBound())
+	{
+		ReachabilityChangedPackages.Reset();
+		return;
+	}
+
+	Delta.RenamedAssets.Emplace(OldSoftObjectPath, AssetData);
+	AssetDataChangedEvent.Broadcast(Delta);
+}
+
+void FAssetActionsManagerModule::OnAssetUpdated(const FAssetData& AssetData)
+{
+	FAssetActionsDelta Delta;
+	InvalidateReferencersForPackage(AssetData.PackageName, Delta.ReferencersChangedPackages);
+	UpdateReachabilityForChangedAsset(AssetData, Delta);
+
+	if (!AssetDataChangedEvent.IsBound())
+	{
+		ReachabilityChangedPackages.Reset();
+		return;
+	}
+
+	if (Delta.IsEmpty()) return;
+
+	AssetDataChangedEvent.Broadcast(Delta);
+}
+
 #pragma endregion
 
 void FAssetActionsManagerModule::ShutdownModule()
 {
-	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(FName("AssetActions"));
+	UnbindCatalogEvents();
+
+	// The registry catalog finishes any file writes still queued by its last save stage
+	Catalog.Reset();
+
+	if (UObjectInitialized())
+	{
+		GetMutableDefault<UAssetActionsNamingSettings>()->OnSettingChanged().Remove(NamingSettingsChangedHandle);
+		GetMutableDefault<UAssetActionsUnusedSettings>()->OnSettingChanged().Remove(UnusedSettingsChangedHandle);
+	}
+
+	if (!IsRunningCommandlet())
+	{
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(FName("AssetActions"));
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,383 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsMemoryCatalog.h"
+#include "Misc/PackageName.h"
+
+#pragma region Filling
+
+void FAssetActionsMemoryCatalog::Reserve(int32 NumAssets)
+{
+	Assets.Reserve(NumAssets);
+	AssetIndexByPackageName.Reserve(NumAssets);
+}
+
+bool FAssetActionsMemoryCatalog::AddAsset(const FAssetData& AssetData)
+{
+	if (AssetIndexByPackageName.Contains(AssetData.PackageName)) return false;
+
+	const int32 AssetIndex = Assets.Add(AssetData);
+
+	AssetIndexByPackageName.Add(AssetData.PackageName, AssetIndex);
+	AssetIndicesByPackagePath.FindOrAdd(AssetData.PackagePath).Add(AssetIndex);
+
+	return true;
+}
+
+void FAssetActionsMemoryCatalog::AddReference(const FName& ReferencerPackageName, const FName& DependencyPackageName)
+{
+	// A package never counts as its own referencer
+	if (ReferencerPackageName == DependencyPackageName) return;
+
+	DependenciesByPackage.FindOrAdd(ReferencerPackageName).Add(DependencyPackageName);
+	ReferencersByPackage.FindOrAdd(DependencyPackageName).Add(ReferencerPackageName);
+}
+
+void FAssetActionsMemoryCatalog::SetParentClass(const FTopLevelAssetPath& ClassPath, const FTopLevelAssetPath& ParentClassPath)
+{
+	ParentClassPaths.Add(ClassPath, ParentClassPath);
+}
+
+#pragma endregion
+
+#pragma region Queries
+
+void FAssetActionsMemoryCatalog::GetAssets(const FARFilter& Filter, TArray<FAssetData>& OutAssets) const
+/*
+	Start from the narrowest index the filter allows: the package names, else the folders, else every asset
+*/
+{
+	if (!Filter.PackageNames.IsEmpty())
+	{
+		for (const FName& PackageName : Filter.PackageNames)
+		{
+			const int32* AssetIndex = AssetIndexByPackageName.Find(PackageName);
+
+			if (!AssetIndex) continue;
+
+			const FAssetData& AssetData = Assets[*AssetIndex];
+
+			if (IsPackagePathInFilter(AssetData.PackagePath, Filter) && IsAssetInFilter(AssetData, Filter))
+			{
+				OutAssets.Add(AssetData);
+			}
+		}
+
+		return;
+	}
+
+	// Without subfolders each folder is a single lookup
+	if (!Filter.PackagePaths.IsEmpty() && !Filter.bRecursivePaths)
+	{
+		for (const FName& PackagePath : Filter.PackagePaths)
+		{
+			const TArray<int32>* FolderAssetIndices = AssetIndicesByPackagePath.Find(PackagePath);
+
+			if (!FolderAssetIndices) continue;
+
+			for (const int32 AssetIndex : *FolderAssetIndices)
+			{
+				if (IsAssetInFilter(Assets[AssetIndex], Filter))
+				{
+					OutAssets.Add(Assets[AssetIndex]);
+				}
+			}
+		}
+
+		return;
+	}
+
+	if (!Filter.PackagePaths.IsEmpty())
+	{
+		for (const TPair<FName, TArray<int32>>& Folder : AssetIndicesByPackagePath)
+		{
+			if (!IsPackagePathInFilter(Folder.Key, Filter)) continue;
+
+			for (const int32 AssetIndex : Folder.Value)
+			{
+				if (IsAssetInFilter(Assets[AssetIndex], Filter))
+				{
+					OutAssets.Add(Assets[AssetIndex]);
+				}
+			}
+		}
+
+		return;
+	}
+
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (IsAssetInFilter(AssetData, Filter))
+		{
+			OutAssets.Add(AssetData);
+		}
+	}
+}
+
+void FAssetActionsMemoryCatalog::GetSubPaths(const FName& PackagePath, TArray<FName>& OutSubPaths) const
+/*
+	The catalog only knows folders that directly hold assets, which are the only ones a listing needs
+*/
+{
+	FARFilter SubPathFilter;
+	SubPathFilter.PackagePaths.Add(PackagePath);
+	SubPathFilter.bRecursivePaths = true;
+
+	for (const TPair<FName, TArray<int32>>& Folder : AssetIndicesByPackagePath)
+	{
+		if (Folder.Key != PackagePath && IsPackagePathInFilter(Folder.Key, SubPathFilter))
+		{
+			OutSubPaths.Add(Folder.Key);
+		}
+	}
+}
+
+void FAssetActionsMemoryCatalog::GetReferencers(const FName& PackageName, TArray<FName>& OutReferencers) const
+{
+	if (const TSet<FName>* Referencers = ReferencersByPackage.Find(PackageName))
+	{
+		OutReferencers.Append(Referencers->Array());
+	}
+}
+
+void FAssetActionsMemoryCatalog::GetDependencies(const FName& PackageName, TArray<FName>& OutDependencies) const
+{
+	if (const TSet<FName>* Dependencies = DependenciesByPackage.Find(PackageName))
+	{
+		OutDependencies.Append(Dependencies->Array());
+	}
+}
+
+void FAssetActionsMemoryCatalog::GetAncestorClassPaths(const FTopLevelAssetPath& ClassPath, TArray<FTopLevelAssetPath>& OutAncestorClassPaths) const
+/*
+	Walk up the parents set with SetParentClass, stopping if a parent was already visited
+*/
+{
+	const FTopLevelAssetPath* ParentClassPath = ParentClassPaths.Find(ClassPath);
+
+	while (ParentClassPath && *ParentClassPath != ClassPath && !OutAncestorClassPaths.Contains(*ParentClassPath))
+	{
+		OutAncestorClassPaths.Add(*ParentClassPath);
+		ParentClassPath = ParentClassPaths.Find(*ParentClassPath);
+	}
+}
+
+bool FAssetActionsMemoryCatalog::IsPackagePathInFilter(const FName& PackagePath, const FARFilter& Filter) const
+{
+	if (Filter.PackagePaths.IsEmpty()) return true;
+
+	if (Filter.PackagePaths.Contains(PackagePath)) return true;
+
+	if (!Filter.bRecursivePaths) return false;
+
+	const FString PackagePathString = PackagePath.ToString();
+
+	for (const FName& FilterPath : Filter.PackagePaths)
+	{
+		const FString FilterPathString = FilterPath.ToString();
+
+		// Match subfolders, but not sibling folders sharing a name prefix
+		if (PackagePathString.StartsWith(FilterPathString) &&
+			PackagePathString.Len() > FilterPathString.Len() && PackagePathString[FilterPathString.Len()] == TEXT('/'))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FAssetActionsMemoryCatalog::IsAssetInFilter(const FAssetData& AssetData, const FARFilter& Filter) const
+{
+	if (!Filter.PackageNames.IsEmpty() && !Filter.PackageNames.Contains(AssetData.PackageName)) return false;
+
+	return Filter.ClassPaths.IsEmpty() || Filter.ClassPaths.Contains(AssetData.AssetClassPath);
+}
+
+#pragma endregion
+
+#pragma region Operations
+
+void FAssetActionsMemoryCatalog::RenameAssets(const TArray<TPair<FSoftObjectPath, FSoftObjectPath>>& ObjectPathRenames,
+	TArray<FSoftObjectPath>& OutRenamedObjectPaths)
+/*
+	Move each asset to its new package and carry its references over, as a rename followed by a redirector
+	fix-up would. Renames to a package that is already taken are skipped.
+*/
+{
+	for (const TPair<FSoftObjectPath, FSoftObjectPath>& ObjectPathRename : ObjectPathRenames)
+	{
+		const FName OldPackageName = ObjectPathRename.Key.GetLongPackageFName();
+		const FName NewPackageName = ObjectPathRename.Value.GetLongPackageFName();
+
+		const int32* FoundAssetIndex = AssetIndexByPackageName.Find(OldPackageName);
+
+		if (!FoundAssetIndex || AssetIndexByPackageName.Contains(NewPackageName)) continue;
+
+		const int32 AssetIndex = *FoundAssetIndex;
+		FAssetData& AssetData = Assets[AssetIndex];
+
+		AssetIndexByPackageName.Remove(OldPackageName);
+		AssetIndicesByPackagePath.FindChecked(AssetData.PackagePath).RemoveSwap(AssetIndex);
+
+		AssetData = FAssetData(NewPackageName, FName(FPackageName::GetLongPackagePath(NewPackageName.ToString())),
+			FName(ObjectPathRename.Value.GetAssetName()), AssetData.AssetClassPath);
+
+		AssetIndexByPackageName.Add(NewPackageName, AssetIndex);
+		AssetIndicesByPackagePath.FindOrAdd(AssetData.PackagePath).Add(AssetIndex);
+
+		RenamePackageReferences(OldPackageName, NewPackageName);
+
+		OutRenamedObjectPaths.Add(ObjectPathRename.Key);
+		AssetRenamedEvent.Broadcast(AssetData, ObjectPathRename.Key.ToString());
+	}
+}
+
+int32 FAssetActionsMemoryCatalog::DeleteAssets(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation)
+/*
+	There is no one to confirm with, so assets are deleted whether or not confirmation was asked for
+*/
+{
+	int32 NumDeleted = 0;
+
+	for (const FAssetData& AssetToDelete : AssetsToDelete)
+	{
+		if (const int32* AssetIndex = AssetIndexByPackageName.Find(AssetToDelete.PackageName))
+		{
+			const FAssetData DeletedAsset = Assets[*AssetIndex];
+
+			RemoveAsset(*AssetIndex);
+			AssetRemovedEvent.Broadcast(DeletedAsset);
+			++NumDeleted;
+		}
+	}
+
+	return NumDeleted;
+}
+
+int32 FAssetActionsMemoryCatalog::DuplicateAssets(const TArray<TPair<FAssetData, FString>>& SourcesAndNewPackageNames)
+/*
+	A copy references everything its source references; nothing references the copy yet
+*/
+{
+	int32 NumDuplicated = 0;
+
+	for (const TPair<FAssetData, FString>& SourceAndNewPackageName : SourcesAndNewPackageNames)
+	{
+		const int32* SourceIndex = AssetIndexByPackageName.Find(SourceAndNewPackageName.Key.PackageName);
+
+		if (!SourceIndex) continue;
+
+		const FString& NewPackageName = SourceAndNewPackageName.Value;
+
+		const FAssetData DuplicatedAsset(FName(NewPackageName), FName(FPackageName::GetLongPackagePath(NewPackageName)),
+			FName(FPackageName::GetShortName(NewPackageName)), Assets[*SourceIndex].AssetClassPath);
+
+		if (!AddAsset(DuplicatedAsset)) continue;
+
+		TArray<FName> SourceDependencies;
+		GetDependencies(SourceAndNewPackageName.Key.PackageName, SourceDependencies);
+
+		for (const FName& SourceDependency : SourceDependencies)
+		{
+			AddReference(DuplicatedAsset.PackageName, SourceDependency);
+		}
+
+		AssetAddedEvent.Broadcast(DuplicatedAsset);
+		++NumDuplicated;
+	}
+
+	return NumDuplicated;
+}
+
+void FAssetActionsMemoryCatalog::FixupRedirectors(const TArray<FAssetData>& Redirectors)
+/*
+	Renames in this catalog never leave redirectors, and redirectors added while filling have no target to
+	point their referencers at, so fixing them up only removes them
+*/
+{
+	for (const FAssetData& Redirector : Redirectors)
+	{
+		if (const int32* AssetIndex = AssetIndexByPackageName.Find(Redirector.PackageName))
+		{
+			const FAssetData RemovedRedirector = Assets[*AssetIndex];
+
+			RemoveAsset(*AssetIndex);
+			AssetRemovedEvent.Broadcast(RemovedRedirector);
+		}
+	}
+}
+
+#pragma endregion
+
+#pragma region Storage
+
+void FAssetActionsMemoryCatalog::RemoveAsset(int32 AssetIndex)
+{
+	const FName PackageName = Assets[AssetIndex].PackageName;
+	const FName PackagePath = Assets[AssetIndex].PackagePath;
+
+	AssetIndexByPackageName.Remove(PackageName);
+
+	TArray<int32>& FolderAssetIndices = AssetIndicesByPackagePath.FindChecked(PackagePath);
+	FolderAssetIndices.RemoveSwap(AssetIndex);
+
+	if (FolderAssetIndices.IsEmpty())
+	{
+		AssetIndicesByPackagePath.Remove(PackagePath);
+	}
+
+	TSet<FName> Dependencies;
+
+	if (DependenciesByPackage.RemoveAndCopyValue(PackageName, Dependencies))
+	{
+		for (const FName& Dependency : Dependencies)
+		{
+			ReferencersByPackage.FindChecked(Dependency).Remove(PackageName);
+		}
+	}
+
+	TSet<FName> Referencers;
+
+	if (ReferencersByPackage.RemoveAndCopyValue(PackageName, Referencers))
+	{
+		for (const FName& Referencer : Referencers)
+		{
+			DependenciesByPackage.FindChecked(Referencer).Remove(PackageName);
+		}
+	}
+
+	Assets.RemoveAt(AssetIndex);
+}
+
+void FAssetActionsMemoryCatalog::RenamePackageReferences(const FName& OldPackageName, const FName& NewPackageName)
+{
+	TSet<FName> Dependencies;
+
+	if (DependenciesByPackage.RemoveAndCopyValue(OldPackageName, Dependencies))
+	{
+		for (const FName& Dependency : Dependencies)
+		{
+			TSet<FName>& DependencyReferencers = ReferencersByPackage.FindChecked(Dependency);
+			DependencyReferencers.Remove(OldPackageName);
+			DependencyReferencers.Add(NewPackageName);
+		}
+
+		DependenciesByPackage.Add(NewPackageName, MoveTemp(Dependencies));
+	}
+
+	TSet<FName> Referencers;
+
+	if (ReferencersByPackage.RemoveAndCopyValue(OldPackageName, Referencers))
+	{
+		for (const FName& Referencer : Referencers)
+		{
+			TSet<FName>& ReferencerDependencies = DependenciesByPackage.FindChecked(Referencer);
+			ReferencerDependencies.Remove(OldPackageName);
+			ReferencerDependencies.Add(NewPackageName);
+		}
+
+		ReferencersByPackage.Add(NewPackageName, MoveTemp(Referencers));
+	}
+}
+
+#pragma endregion
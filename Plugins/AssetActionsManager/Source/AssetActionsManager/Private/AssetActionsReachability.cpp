@@ -0,0 +1,312 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsReachability.h"
+#include "AssetActionsCatalog.h"
+#include "AssetActionsStats.h"
+#include "AssetActionsUnusedSettings.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "Settings/ProjectPackagingSettings.h"
+
+DECLARE_CYCLE_STAT(TEXT("Gather Reachability Roots"), STAT_AssetActions_GatherReachabilityRoots, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Build Reachability"), STAT_AssetActions_BuildReachability, STATGROUP_AssetActions);
+
+void FAssetActionsReachability::GatherRootPackages(const IAssetActionsCatalog& Catalog, const UAssetActionsUnusedSettings& Settings,
+	TArray<FName>& OutRootPackages)
+/*
+	Collect roots with at most two catalog queries: one for every map and one for every root folder together.
+	A filter with no folders would match every asset, so the folder query only runs when there are folders.
+*/
+{
+	ASSET_ACTIONS_SCOPE(GatherReachabilityRoots);
+
+	TArray<FAssetData> RootAssetData;
+
+	if (Settings.bMapsAreRoots)
+	{
+		FARFilter MapFilter;
+		MapFilter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
+		Catalog.GetAssets(MapFilter, RootAssetData);
+	}
+
+	FARFilter FolderFilter;
+	FolderFilter.bRecursivePaths = true;
+
+	auto AddRootFolder = [&FolderFilter](FString FolderPath)
+		{
+			FolderPath.RemoveFromEnd(TEXT("/"));
+
+			if (!FolderPath.IsEmpty())
+			{
+				FolderFilter.PackagePaths.Add(FName(FolderPath));
+			}
+		};
+
+	for (const FDirectoryPath& RootFolder : Settings.RootFolders)
+	{
+		AddRootFolder(RootFolder.Path);
+	}
+
+	if (Settings.bAlwaysCookedAreRoots)
+	{
+		const UProjectPackagingSettings* PackagingSettings = GetDefault<UProjectPackagingSettings>();
+
+		for (const FDirectoryPath& DirectoryToCook : PackagingSettings->DirectoriesToAlwaysCook)
+		{
+			AddRootFolder(DirectoryToCook.Path);
+		}
+
+		// Maps to cook may be stored as file paths or as package names
+		for (const FFilePath& MapToCook : PackagingSettings->MapsToCook)
+		{
+			FString MapPackageName;
+
+			if (FPackageName::TryConvertFilenameToLongPackageName(MapToCook.FilePath, MapPackageName))
+			{
+				OutRootPackages.Add(FName(MapPackageName));
+			}
+		}
+	}
+
+	if (!FolderFilter.PackagePaths.IsEmpty())
+	{
+		Catalog.GetAssets(FolderFilter, RootAssetData);
+	}
+
+	for (const FAssetData& RootAsset : RootAssetData)
+	{
+		OutRootPackages.Add(RootAsset.PackageName);
+	}
+
+	for (const FSoftObjectPath& RootAssetPath : Settings.RootAssets)
+	{
+		if (RootAssetPath.IsValid())
+		{
+			OutRootPackages.Add(RootAssetPath.GetLongPackageFName());
+		}
+	}
+
+	// Primary assets, and those the Asset Manager rules always cook
+	if ((Settings.bPrimaryAssetsAreRoots || Settings.bAlwaysCookedAreRoots) && UAssetManager::IsInitialized())
+	{
+		const UAssetManager& AssetManager = UAssetManager::Get();
+
+		TArray<FPrimaryAssetTypeInfo> PrimaryAssetTypes;
+		AssetManager.GetPrimaryAssetTypeInfoList(PrimaryAssetTypes);
+
+		TArray<FPrimaryAssetId> PrimaryAssetIds;
+
+		for (const FPrimaryAssetTypeInfo& PrimaryAssetType : PrimaryAssetTypes)
+		{
+			PrimaryAssetIds.Reset();
+			AssetManager.GetPrimaryAssetIdList(PrimaryAssetType.PrimaryAssetType, PrimaryAssetIds);
+
+			for (const FPrimaryAssetId& PrimaryAssetId : PrimaryAssetIds)
+			{
+				const bool bAlwaysCooked = AssetManager.GetPrimaryAssetRules(PrimaryAssetId).CookRule == EPrimaryAssetCookRule::AlwaysCook;
+
+				if (!Settings.bPrimaryAssetsAreRoots && !(Settings.bAlwaysCookedAreRoots && bAlwaysCooked)) continue;
+
+				const FSoftObjectPath PrimaryAssetPath = AssetManager.GetPrimaryAssetPath(PrimaryAssetId);
+
+				if (PrimaryAssetPath.IsValid())
+				{
+					OutRootPackages.Add(PrimaryAssetPath.GetLongPackageFName());
+				}
+			}
+		}
+	}
+}
+
+bool FAssetActionsReachability::IsRootAsset(const FAssetData& AssetData, const UAssetActionsUnusedSettings& Settings)
+/*
+	Test one asset against each root source, cheapest first
+*/
+{
+	if (Settings.bMapsAreRoots && AssetData.AssetClassPath == UWorld::StaticClass()->GetClassPathName()) return true;
+
+	const FString PackageName = AssetData.PackageName.ToString();
+
+	auto IsInFolder = [&PackageName](FString FolderPath)
+		{
+			FolderPath.RemoveFromEnd(TEXT("/"));
+			return !FolderPath.IsEmpty() && PackageName.StartsWith(FolderPath + TEXT("/"));
+		};
+
+	for (const FDirectoryPath& RootFolder : Settings.RootFolders)
+	{
+		if (IsInFolder(RootFolder.Path)) return true;
+	}
+
+	for (const FSoftObjectPath& RootAssetPath : Settings.RootAssets)
+	{
+		if (RootAssetPath.IsValid() && RootAssetPath.GetLongPackageFName() == AssetData.PackageName) return true;
+	}
+
+	if (Settings.bAlwaysCookedAreRoots)
+	{
+		const UProjectPackagingSettings* PackagingSettings = GetDefault<UProjectPackagingSettings>();
+
+		for (const FDirectoryPath& DirectoryToCook : PackagingSettings->DirectoriesToAlwaysCook)
+		{
+			if (IsInFolder(DirectoryToCook.Path)) return true;
+		}
+
+		for (const FFilePath& MapToCook : PackagingSettings->MapsToCook)
+		{
+			FString MapPackageName;
+
+			if (FPackageName::TryConvertFilenameToLongPackageName(MapToCook.FilePath, MapPackageName) && MapPackageName == PackageName) return true;
+		}
+	}
+
+	if ((Settings.bPrimaryAssetsAreRoots || Settings.bAlwaysCookedAreRoots) && UAssetManager::IsInitialized())
+	{
+		const UAssetManager& AssetManager = UAssetManager::Get();
+		const FPrimaryAssetId PrimaryAssetId = AssetManager.GetPrimaryAssetIdForPackage(AssetData.PackageName);
+
+		if (PrimaryAssetId.IsValid())
+		{
+			return Settings.bPrimaryAssetsAreRoots || 
+				AssetManager.GetPrimaryAssetRules(PrimaryAssetId).CookRule == EPrimaryAssetCookRule::AlwaysCook;
+		}
+	}
+
+	return false;
+}
+
+void FAssetActionsReachability::Build(const IAssetActionsCatalog& Catalog, const TArray<FName>& RootPackages, TSet<FName>* OutChangedPackages)
+/*
+	Breadth-first mark from the roots. The previous marks are only kept aside when the caller asks which packages 
+	changed, and then compared both ways once the new marks are complete.
+*/
+{
+	ASSET_ACTIONS_SCOPE(BuildReachability);
+
+	TSet<FName> PreviousPackages;
+
+	if (OutChangedPackages)
+	{
+		PreviousPackages = MoveTemp(ReachablePackages);
+	}
+
+	ReachablePackages.Reset();
+	DependenciesByPackage.Reset();
+
+	TArray<FName> PackagesToVisit;
+	PackagesToVisit.Reserve(RootPackages.Num());
+
+	for (const FName& RootPackage : RootPackages)
+	{
+		bool bAlreadyReached = false;
+		ReachablePackages.Add(RootPackage, &bAlreadyReached);
+
+		if (!bAlreadyReached)
+		{
+			PackagesToVisit.Add(RootPackage);
+		}
+	}
+
+	MarkQueued(Catalog, PackagesToVisit, nullptr);
+
+	if (!OutChangedPackages) return;
+
+	for (const FName& ReachablePackage : ReachablePackages)
+	{
+		if (!PreviousPackages.Contains(ReachablePackage))
+		{
+			OutChangedPackages->Add(ReachablePackage);
+		}
+	}
+
+	for (const FName& PreviousPackage : PreviousPackages)
+	{
+		if (!ReachablePackages.Contains(PreviousPackage))
+		{
+			OutChangedPackages->Add(PreviousPackage);
+		}
+	}
+}
+
+void FAssetActionsReachability::MarkFrom(const IAssetActionsCatalog& Catalog, const FName& PackageName, TArray<FName>&& Dependencies,
+	TSet<FName>& OutNewlyReached)
+/*
+	Only dependencies that are not marked yet are visited, so re-saving a reached package without new references
+	costs one lookup per reference
+*/
+{
+	bool bAlreadyReached = false;
+	ReachablePackages.Add(PackageName, &bAlreadyReached);
+
+	if (!bAlreadyReached)
+	{
+		OutNewlyReached.Add(PackageName);
+	}
+
+	TArray<FName> PackagesToVisit;
+
+	for (const FName& Dependency : Dependencies)
+	{
+		bool bDependencyReached = false;
+		ReachablePackages.Add(Dependency, &bDependencyReached);
+
+		if (!bDependencyReached)
+		{
+			OutNewlyReached.Add(Dependency);
+			PackagesToVisit.Add(Dependency);
+		}
+	}
+
+	DependenciesByPackage.Add(PackageName, MoveTemp(Dependencies));
+
+	MarkQueued(Catalog, PackagesToVisit, &OutNewlyReached);
+}
+
+bool FAssetActionsReachability::LosesDependencies(const FName& PackageName, const TArray<FName>& Dependencies) const
+{
+	const TArray<FName>* MarkedDependencies = DependenciesByPackage.Find(PackageName);
+
+	if (!MarkedDependencies) return false;
+
+	for (const FName& MarkedDependency : *MarkedDependencies)
+	{
+		if (!Dependencies.Contains(MarkedDependency)) return true;
+	}
+
+	return false;
+}
+
+void FAssetActionsReachability::MarkQueued(const IAssetActionsCatalog& Catalog, TArray<FName>& PackagesToVisit, TSet<FName>* OutNewlyReached)
+/*
+	The visit queue doubles as the list of reached packages: a package is marked and queued the first time it is 
+	seen, so each one is queried for its dependencies exactly once.
+*/
+{
+	for (int32 VisitIndex = 0; VisitIndex < PackagesToVisit.Num(); ++VisitIndex)
+	{
+		// Copied since adding to the queue may reallocate it
+		const FName PackageName = PackagesToVisit[VisitIndex];
+
+		TArray<FName> Dependencies;
+		Catalog.GetDependencies(PackageName, Dependencies);
+
+		for (const FName& Dependency : Dependencies)
+		{
+			bool bAlreadyReached = false;
+			ReachablePackages.Add(Dependency, &bAlreadyReached);
+
+			if (!bAlreadyReached)
+			{
+				PackagesToVisit.Add(Dependency);
+
+				if (OutNewlyReached)
+				{
+					OutNewlyReached->Add(Dependency);
+				}
+			}
+		}
+
+		DependenciesByPackage.Add(PackageName, MoveTemp(Dependencies));
+	}
+}
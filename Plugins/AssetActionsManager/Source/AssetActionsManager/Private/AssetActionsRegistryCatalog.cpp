@@ -0,0 +1,402 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsRegistryCatalog.h"
+#include "AssetActionsStats.h"
+#include "AssetToolsModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetViewUtils.h"
+#include "DebugHelper.h"
+#include "EditorAssetLibrary.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "Misc/PathViews.h"
+#include "ObjectTools.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAssetActionsSave, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Registry Get Assets"), STAT_AssetActions_RegistryGetAssets, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Registry Get Referencers"), STAT_AssetActions_RegistryGetReferencers, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Get Package Timestamps"), STAT_AssetActions_GetPackageTimestamps, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Save Packages In Stage"), STAT_AssetActions_SavePackagesInStage, STATGROUP_AssetActions);
+
+#pragma region RegistryEvents
+
+FAssetActionsRegistryCatalog::FAssetActionsRegistryCatalog()
+/*
+	Forward asset registry events so catalog listeners see every change made in the editor
+*/
+{
+	// Loads the registry if it isn't yet; from then on the catalog reaches it through its singleton
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddLambda(
+		[this](const FAssetData& AssetData) { AssetAddedEvent.Broadcast(AssetData); });
+
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda(
+		[this](const FAssetData& AssetData) { AssetRemovedEvent.Broadcast(AssetData); });
+
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda(
+		[this](const FAssetData& AssetData, const FString& OldObjectPath) { AssetRenamedEvent.Broadcast(AssetData, OldObjectPath); });
+
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddLambda(
+		[this](const FAssetData& AssetData) { AssetUpdatedEvent.Broadcast(AssetData); });
+}
+
+FAssetActionsRegistryCatalog::~FAssetActionsRegistryCatalog()
+/*
+	Finish any file writes still queued by the last save stage and remove the registry bindings;
+	the registry may already be unloaded during editor shutdown
+*/
+{
+	UPackage::WaitForAsyncFileWrites();
+
+	if (!FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry"))) return;
+
+	IAssetRegistry& AssetRegistry = GetAssetRegistry();
+
+	AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+	AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+	AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+}
+
+IAssetRegistry& FAssetActionsRegistryCatalog::GetAssetRegistry() const
+/*
+	Use the registry singleton rather than the module manager, which may only be used on the game thread; 
+	queries run on worker threads while filtering
+*/
+{
+	return IAssetRegistry::GetChecked();
+}
+
+#pragma endregion
+
+#pragma region Queries
+
+void FAssetActionsRegistryCatalog::GetAssets(const FARFilter& Filter, TArray<FAssetData>& OutAssets) const
+{
+	ASSET_ACTIONS_SCOPE(RegistryGetAssets);
+	ASSET_ACTIONS_COUNT(RegistryQueries, 1);
+
+	GetAssetRegistry().GetAssets(Filter, OutAssets);
+}
+
+void FAssetActionsRegistryCatalog::GetSubPaths(const FName& PackagePath, TArray<FName>& OutSubPaths) const
+{
+	ASSET_ACTIONS_COUNT(RegistryQueries, 1);
+
+	GetAssetRegistry().GetSubPaths(PackagePath, OutSubPaths, true);
+}
+
+void FAssetActionsRegistryCatalog::GetReferencers(const FName& PackageName, TArray<FName>& OutReferencers) const
+{
+	ASSET_ACTIONS_SCOPE(RegistryGetReferencers);
+	ASSET_ACTIONS_COUNT(RegistryQueries, 1);
+
+	GetAssetRegistry().GetReferencers(PackageName, OutReferencers, UE::AssetRegistry::EDependencyCategory::Package);
+}
+
+void FAssetActionsRegistryCatalog::GetDependencies(const FName& PackageName, TArray<FName>& OutDependencies) const
+{
+	ASSET_ACTIONS_COUNT(RegistryQueries, 1);
+
+	GetAssetRegistry().GetDependencies(PackageName, OutDependencies, UE::AssetRegistry::EDependencyCategory::Package);
+}
+
+void FAssetActionsRegistryCatalog::GetAncestorClassPaths(const FTopLevelAssetPath& ClassPath, TArray<FTopLevelAssetPath>& OutAncestorClassPaths) const
+{
+	ASSET_ACTIONS_COUNT(RegistryQueries, 1);
+
+	GetAssetRegistry().GetAncestorClassNames(ClassPath, OutAncestorClassPaths);
+}
+
+bool FAssetActionsRegistryCatalog::GetFolderPackageTimestamps(const TArray<FString>& FolderPaths, TMap<FName, FDateTime>& OutPackageTimestamps) const
+/*
+	Walk only the directories of the folders, taking each package's timestamp from the directory listing instead of 
+	opening files. Nested folders are walked once as part of their parent.
+*/
+{
+	ASSET_ACTIONS_SCOPE(GetPackageTimestamps);
+
+	for (const FString& FolderPath : FolderPaths)
+	{
+		const bool bInsideOtherFolder = FolderPaths.ContainsByPredicate([&FolderPath](const FString& OtherFolderPath)
+			{
+				return OtherFolderPath != FolderPath && FolderPath.StartsWith(OtherFolderPath / TEXT(""));
+			});
+
+		if (bInsideOtherFolder) continue;
+
+		FString FolderFilename;
+
+		if (!FPackageName::TryConvertLongPackageNameToFilename(FolderPath, FolderFilename)) continue;
+
+		FolderFilename = FPaths::ConvertRelativePathToFull(FolderFilename);
+
+		IFileManager::Get().IterateDirectoryStatRecursively(*FolderFilename,
+			[&OutPackageTimestamps, &FolderPath, &FolderFilename](const TCHAR* Filename, const FFileStatData& StatData)
+			{
+				if (StatData.bIsDirectory) return true;
+
+				const FStringView FilenameView(Filename);
+				const FStringView Extension = FPathViews::GetExtension(FilenameView, true);
+
+				if (Extension != FPackageName::GetAssetPackageExtension() && Extension != FPackageName::GetMapPackageExtension()) return true;
+
+				// Content/Folder/Sub/Asset.uasset under folder /Game/Folder is package /Game/Folder/Sub/Asset
+				const FStringView RelativePath = FilenameView.Mid(FolderFilename.Len(), FilenameView.Len() - FolderFilename.Len() - Extension.Len());
+
+				FString PackageName = FolderPath;
+				PackageName.Append(RelativePath);
+
+				OutPackageTimestamps.Add(FName(PackageName), StatData.ModificationTime);
+				return true;
+			});
+	}
+
+	return true;
+}
+
+void FAssetActionsRegistryCatalog::GetPackageTimestamps(const TArray<FName>& PackageNames, TMap<FName, FDateTime>& OutPackageTimestamps) const
+/*
+	One stat per package, or two for maps; only used for the few packages outside the audited folders
+*/
+{
+	ASSET_ACTIONS_SCOPE(GetPackageTimestamps);
+
+	for (const FName& PackageName : PackageNames)
+	{
+		FString BaseFilename;
+
+		if (!FPackageName::TryConvertLongPackageNameToFilename(PackageName.ToString(), BaseFilename)) continue;
+
+		FFileStatData StatData = IFileManager::Get().GetStatData(*(BaseFilename + FPackageName::GetAssetPackageExtension()));
+
+		if (!StatData.bIsValid)
+		{
+			StatData = IFileManager::Get().GetStatData(*(BaseFilename + FPackageName::GetMapPackageExtension()));
+		}
+
+		if (StatData.bIsValid)
+		{
+			OutPackageTimestamps.Add(PackageName, StatData.ModificationTime);
+		}
+	}
+}
+
+#pragma endregion
+
+#pragma region Operations
+
+void FAssetActionsRegistryCatalog::RenameAssets(const TArray<TPair<FSoftObjectPath, FSoftObjectPath>>& ObjectPathRenames,
+	TArray<FSoftObjectPath>& OutRenamedObjectPaths)
+/*
+	Submit every rename to asset tools at once so referencers are loaded and fixed up in a single pass, then save
+	the renamed packages together with every package the renames dirtied (referencers and redirectors) in one call.
+	Packages that were already dirty before the batch are left for the user to save.
+*/
+{
+	if (ObjectPathRenames.IsEmpty()) return;
+
+	TArray<FAssetRenameData> RenameBatch;
+	RenameBatch.Reserve(ObjectPathRenames.Num());
+
+	for (const TPair<FSoftObjectPath, FSoftObjectPath>& ObjectPathRename : ObjectPathRenames)
+	{
+		// Asset tools renames this object in place, so it is the one that must be found at the new path afterwards
+		FAssetRenameData& RenameData = RenameBatch.Emplace_GetRef(ObjectPathRename.Key, ObjectPathRename.Value);
+		RenameData.Asset = ObjectPathRename.Key.TryLoad();
+	}
+
+	TArray<UPackage*> DirtyPackagesBeforeRename;
+	FEditorFileUtils::GetDirtyContentPackages(DirtyPackagesBeforeRename);
+
+	FAssetToolsModule& AssetToolsModule =
+		FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+
+	AssetToolsModule.Get().RenameAssets(RenameBatch);
+
+	// Asset tools reports failures itself; a rename succeeded if the renamed asset itself now lives at its new path,
+	// not some other object that already held it
+	TSet<UPackage*> PackagesToSave;
+
+	for (const FAssetRenameData& RenameData : RenameBatch)
+	{
+		UObject* RenamedAsset = RenameData.NewObjectPath.ResolveObject();
+
+		if (RenamedAsset && RenamedAsset == RenameData.Asset.Get())
+		{
+			OutRenamedObjectPaths.Add(RenameData.OldObjectPath);
+			PackagesToSave.Add(RenamedAsset->GetPackage());
+		}
+	}
+
+	if (PackagesToSave.IsEmpty()) return;
+
+	TArray<UPackage*> DirtyPackagesAfterRename;
+	FEditorFileUtils::GetDirtyContentPackages(DirtyPackagesAfterRename);
+
+	const TSet<UPackage*> AlreadyDirtyPackages(DirtyPackagesBeforeRename);
+
+	for (UPackage* DirtyPackage : DirtyPackagesAfterRename)
+	{
+		if (!AlreadyDirtyPackages.Contains(DirtyPackage))
+		{
+			PackagesToSave.Add(DirtyPackage);
+		}
+	}
+
+	SavePackagesInStage(PackagesToSave.Array());
+}
+
+int32 FAssetActionsRegistryCatalog::DeleteAssets(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation)
+{
+	return ObjectTools::DeleteAssets(AssetsToDelete, bShowConfirmation);
+}
+
+int32 FAssetActionsRegistryCatalog::DuplicateAssets(const TArray<TPair<FAssetData, FString>>& SourcesAndNewPackageNames)
+/*
+	Duplicate each asset, then save every new package in one stage
+*/
+{
+	TArray<UPackage*> PackagesToSave;
+	PackagesToSave.Reserve(SourcesAndNewPackageNames.Num());
+
+	for (const TPair<FAssetData, FString>& SourceAndNewPackageName : SourcesAndNewPackageNames)
+	{
+		const FString SourceAssetPath = SourceAndNewPackageName.Key.PackageName.ToString();
+
+		if (UObject* DuplicatedAsset = UEditorAssetLibrary::DuplicateAsset(SourceAssetPath, SourceAndNewPackageName.Value))
+		{
+			PackagesToSave.Add(DuplicatedAsset->GetPackage());
+		}
+	}
+
+	SavePackagesInStage(PackagesToSave);
+
+	return PackagesToSave.Num();
+}
+
+void FAssetActionsRegistryCatalog::FixupRedirectors(const TArray<FAssetData>& Redirectors)
+/*
+	Load the redirectors and let asset tools fix up their referencers
+*/
+{
+	if (Redirectors.IsEmpty()) return;
+
+	// Get paths for each asset
+	TArray<FString> ObjectPaths;
+
+	for (const FAssetData& Asset : Redirectors)
+	{
+		ObjectPaths.Add(Asset.GetObjectPathString());
+	}
+
+	// Load assets
+	TArray<UObject*> Objects;
+	bool Result = AssetViewUtils::LoadAssetsIfNeeded(ObjectPaths, Objects, true, true);
+
+	if (Result)
+	{
+		// Convert objects to object redirectors
+		TArray<UObjectRedirector*> RedirectorObjects;
+		for (UObject* Object : Objects)
+		{
+			RedirectorObjects.Add(CastChecked<UObjectRedirector>(Object));
+		}
+
+		// Call fix up redirectors from asset tools
+		FAssetToolsModule& AssetToolsModule =
+			FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+
+		AssetToolsModule.Get().FixupReferencers(RedirectorObjects);
+	}
+}
+
+#pragma endregion
+
+#pragma region SaveStage
+
+void FAssetActionsRegistryCatalog::SavePackagesInStage(const TArray<UPackage*>& PackagesToSave)
+/*
+	Serialize each dirty package and hand its file write to the async writer, so disk I/O for one package overlaps
+	with serializing the next and with whatever the caller does after the stage returns. Writes from the previous
+	stage are flushed first so a package is never queued twice. Timings per package go to LogAssetActionsSave at 
+	Verbose; the stage itself prints one summary line.
+*/
+{
+	ASSET_ACTIONS_SCOPE(SavePackagesInStage);
+
+	UPackage::WaitForAsyncFileWrites();
+
+	TArray<UPackage*> DirtyPackages;
+	DirtyPackages.Reserve(PackagesToSave.Num());
+
+	TSet<UPackage*> SeenPackages;
+	SeenPackages.Reserve(PackagesToSave.Num());
+
+	for (UPackage* Package : PackagesToSave)
+	{
+		bool bAlreadySeen = false;
+		SeenPackages.Add(Package, &bAlreadySeen);
+
+		if (!bAlreadySeen && Package && Package->IsDirty())
+		{
+			DirtyPackages.Add(Package);
+		}
+	}
+
+	if (DirtyPackages.IsEmpty()) return;
+
+	if (ISourceControlModule::Get().IsEnabled())
+	{
+		FEditorFileUtils::CheckoutPackages(DirtyPackages, nullptr, false);
+	}
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+	SaveArgs.Error = GWarn;
+
+	int32 NumSaved = 0;
+	double SlowestSaveMilliseconds = 0.0;
+	FString SlowestPackageName;
+	const double StageStartTime = FPlatformTime::Seconds();
+
+	for (UPackage* Package : DirtyPackages)
+	{
+		const FString PackageExtension = Package->ContainsMap() ?
+			FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension();
+
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(Package->GetName(), PackageExtension);
+
+		const double SaveStartTime = FPlatformTime::Seconds();
+		const FSavePackageResultStruct SaveResult = UPackage::Save(Package, nullptr, *PackageFilename, SaveArgs);
+		const double SaveMilliseconds = (FPlatformTime::Seconds() - SaveStartTime) * 1000.0;
+
+		if (SaveMilliseconds > SlowestSaveMilliseconds)
+		{
+			SlowestSaveMilliseconds = SaveMilliseconds;
+			SlowestPackageName = Package->GetName();
+		}
+
+		if (SaveResult.IsSuccessful())
+		{
+			++NumSaved;
+			UE_LOG(LogAssetActionsSave, Verbose, TEXT("Saved %s in %.2f ms"), *Package->GetName(), SaveMilliseconds);
+		}
+
+		else
+		{
+			UE_LOG(LogAssetActionsSave, Warning, TEXT("Failed to save %s after %.2f ms"), *Package->GetName(), SaveMilliseconds);
+		}
+	}
+
+	ASSET_ACTIONS_COUNT(PackagesSaved, NumSaved);
+
+	DebugHelper::PrintLog(FString::Printf(TEXT("Save stage serialized %d of %d packages in %.2f ms, slowest %s in %.2f ms; file writes continue in the background"),
+		NumSaved, DirtyPackages.Num(), (FPlatformTime::Seconds() - StageStartTime) * 1000.0, *SlowestPackageName, SlowestSaveMilliseconds));
+}
+
+#pragma endregion
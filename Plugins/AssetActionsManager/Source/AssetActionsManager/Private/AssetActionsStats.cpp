@@ -0,0 +1,13 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsStats.h"
+
+DEFINE_STAT(STAT_AssetActions_RegistryQueries);
+DEFINE_STAT(STAT_AssetActions_RowsGenerated);
+DEFINE_STAT(STAT_AssetActions_AssetsFiltered);
+DEFINE_STAT(STAT_AssetActions_PackagesSaved);
+
+TRACE_DECLARE_INT_COUNTER(AssetActions_RegistryQueries, TEXT("AssetActions/RegistryQueries"));
+TRACE_DECLARE_INT_COUNTER(AssetActions_RowsGenerated, TEXT("AssetActions/RowsGenerated"));
+TRACE_DECLARE_INT_COUNTER(AssetActions_AssetsFiltered, TEXT("AssetActions/AssetsFiltered"));
+TRACE_DECLARE_INT_COUNTER(AssetActions_PackagesSaved, TEXT("AssetActions/PackagesSaved"));
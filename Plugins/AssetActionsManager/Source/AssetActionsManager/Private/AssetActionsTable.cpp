@@ -0,0 +1,231 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsTable.h"
+
+void FAssetActionsTable::Reset(TArray<FAssetData>&& AssetsData)
+/*
+	Drop every row and lay the assets out in consecutive rows
+*/
+{
+	const int32 NumRows = AssetsData.Num();
+
+	Items.Empty(NumRows);
+	PackageNames.Empty(NumRows);
+	AssetNames.Empty(NumRows);
+	PackagePaths.Empty(NumRows);
+	AssetClassPaths.Empty(NumRows);
+	LiveRows.Init(true, NumRows);
+	FreeRows.Empty();
+	NumLiveRows = NumRows;
+
+	RowsByPackageName.Reset(NumRows);
+	RowsByAssetName.Reset(NumRows);
+	RowsByItem.Empty(NumRows);
+
+	Items.SetNum(NumRows);
+	PackageNames.SetNum(NumRows);
+	AssetNames.SetNum(NumRows);
+	PackagePaths.SetNum(NumRows);
+	AssetClassPaths.SetNum(NumRows);
+
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		Items[Row] = MakeShared<FAssetData>(MoveTemp(AssetsData[Row]));
+		WriteRow(Row, *Items[Row]);
+		RowsByItem.Add(Items[Row].Get(), Row);
+	}
+}
+
+int32 FAssetActionsTable::AddRow(const FAssetData& AssetData)
+/*
+	Reuse a tombstoned row if there is one, otherwise append a row to every column
+*/
+{
+	int32 Row;
+
+	if (FreeRows.Num() > 0)
+	{
+		Row = FreeRows.Pop(EAllowShrinking::No);
+		LiveRows[Row] = true;
+	}
+
+	else
+	{
+		Row = Items.AddDefaulted();
+		PackageNames.AddDefaulted();
+		AssetNames.AddDefaulted();
+		PackagePaths.AddDefaulted();
+		AssetClassPaths.AddDefaulted();
+		LiveRows.Add(true);
+	}
+
+	Items[Row] = MakeShared<FAssetData>(AssetData);
+	WriteRow(Row, AssetData);
+	RowsByItem.Add(Items[Row].Get(), Row);
+	++NumLiveRows;
+
+	return Row;
+}
+
+void FAssetActionsTable::RemoveRow(int32 Row)
+{
+	if (!IsValidRow(Row)) return;
+
+	RemoveRowFromNameLookups(Row);
+	RowsByItem.Remove(Items[Row].Get());
+
+	Items[Row].Reset();
+	PackageNames[Row] = NAME_None;
+	AssetNames[Row] = NAME_None;
+	PackagePaths[Row] = NAME_None;
+	AssetClassPaths[Row].Reset();
+
+	LiveRows[Row] = false;
+	FreeRows.Add(Row);
+	--NumLiveRows;
+}
+
+void FAssetActionsTable::UpdateRow(int32 Row, const FAssetData& AssetData)
+{
+	if (!IsValidRow(Row)) return;
+
+	RemoveRowFromNameLookups(Row);
+
+	*Items[Row] = AssetData;
+	WriteRow(Row, AssetData);
+}
+
+int32 FAssetActionsTable::FindRow(const FSoftObjectPath& ObjectPath) const
+/*
+	Narrow the search to the asset's package, then compare object paths; packages rarely hold more than one asset
+*/
+{
+	if (const TArray<int32>* PackageRows = RowsByPackageName.Find(ObjectPath.GetLongPackageFName()))
+	{
+		for (const int32 Row : *PackageRows)
+		{
+			if (Items[Row]->GetSoftObjectPath() == ObjectPath)
+			{
+				return Row;
+			}
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32 FAssetActionsTable::FindRow(const TSharedPtr<FAssetData>& Item) const
+{
+	if (const int32* FoundRow = RowsByItem.Find(Item.Get()))
+	{
+		return *FoundRow;
+	}
+
+	return INDEX_NONE;
+}
+
+void FAssetActionsTable::FindRowsByPackageName(const FName& PackageName, TArray<int32>& OutRows) const
+{
+	if (const TArray<int32>* PackageRows = RowsByPackageName.Find(PackageName))
+	{
+		OutRows.Append(*PackageRows);
+	}
+}
+
+void FAssetActionsTable::FindRowsByAssetName(const FName& AssetName, TArray<int32>& OutRows) const
+{
+	if (const TArray<int32>* NameRows = RowsByAssetName.Find(AssetName))
+	{
+		OutRows.Append(*NameRows);
+	}
+}
+
+int32 FAssetActionsTable::NumRowsWithAssetName(const FName& AssetName) const
+{
+	const TArray<int32>* NameRows = RowsByAssetName.Find(AssetName);
+
+	return NameRows ? NameRows->Num() : 0;
+}
+
+void FAssetActionsTable::GetItems(const TBitArray<>& Rows, TArray<TSharedPtr<FAssetData>>& OutItems) const
+/*
+	Gather the list items for a bitset over the rows; tombstoned rows are skipped
+*/
+{
+	OutItems.Reset();
+
+	for (TConstSetBitIterator<> It(Rows); It; ++It)
+	{
+		if (IsValidRow(It.GetIndex()))
+		{
+			OutItems.Add(Items[It.GetIndex()]);
+		}
+	}
+}
+
+void FAssetActionsTable::PadRows(TBitArray<>& Rows) const
+{
+	if (Rows.Num() < Items.Num())
+	{
+		Rows.Add(false, Items.Num() - Rows.Num());
+	}
+}
+
+void FAssetActionsTable::WriteRow(int32 Row, const FAssetData& AssetData)
+{
+	PackageNames[Row] = AssetData.PackageName;
+	AssetNames[Row] = AssetData.AssetName;
+	PackagePaths[Row] = AssetData.PackagePath;
+	AssetClassPaths[Row] = AssetData.AssetClassPath;
+
+	RowsByPackageName.Add(AssetData.PackageName, Row);
+	RowsByAssetName.Add(AssetData.AssetName, Row);
+}
+
+void FAssetActionsTable::RemoveRowFromNameLookups(int32 Row)
+{
+	RowsByPackageName.Remove(PackageNames[Row], Row);
+	RowsByAssetName.Remove(AssetNames[Row], Row);
+}
+
+void FAssetActionsTable::FRowsByName::Reset(int32 NumRows)
+{
+	Rows.Empty(NumRows);
+	Slots.Empty(NumRows);
+}
+
+void FAssetActionsTable::FRowsByName::Add(const FName& Name, int32 Row)
+{
+	TArray<int32>& NameRows = Rows.FindOrAdd(Name);
+
+	if (Slots.Num() <= Row)
+	{
+		Slots.SetNum(Row + 1);
+	}
+
+	Slots[Row] = NameRows.Add(Row);
+}
+
+void FAssetActionsTable::FRowsByName::Remove(const FName& Name, int32 Row)
+/*
+	Swap the last row of the name into the removed row's slot and point that row at its new slot
+*/
+{
+	TArray<int32>* NameRows = Rows.Find(Name);
+
+	if (!NameRows || !Slots.IsValidIndex(Row)) return;
+
+	const int32 Slot = Slots[Row];
+
+	if (!NameRows->IsValidIndex(Slot) || (*NameRows)[Slot] != Row) return;
+
+	const int32 LastRow = NameRows->Last();
+	(*NameRows)[Slot] = LastRow;
+	Slots[LastRow] = Slot;
+	NameRows->Pop(EAllowShrinking::No);
+
+	if (NameRows->IsEmpty())
+	{
+		Rows.Remove(Name);
+	}
+}
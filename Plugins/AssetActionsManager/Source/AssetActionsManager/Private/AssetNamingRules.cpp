@@ -0,0 +1,365 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetNamingRules.h"
+#include "AssetActionsCatalog.h"
+#include "AssetActionsNamingSettings.h"
+#include "DebugHelper.h"
+
+#pragma region Automaton
+
+int32 FAssetNamingRules::AddPattern(const FString& Pattern)
+/*
+	Walk the trie along the lowercase pattern, adding states where the path ends, and record the pattern on
+	its last state
+*/
+{
+	if (const int32* PatternId = PatternIds.Find(Pattern))
+	{
+		return *PatternId;
+	}
+
+	int32 State = 0;
+
+	for (const TCHAR Char : Pattern)
+	{
+		const TCHAR LowerChar = FChar::ToLower(Char);
+		const uint64 TransitionKey = MakeTransitionKey(State, LowerChar);
+
+		if (const int32* NextState = Transitions.Find(TransitionKey))
+		{
+			State = *NextState;
+			continue;
+		}
+
+		const int32 NewState = FailLinks.Add(0);
+		Children.AddDefaulted();
+		Outputs.AddDefaulted();
+
+		Transitions.Add(TransitionKey, NewState);
+		Children[State].Add(TPair<TCHAR, int32>(LowerChar, NewState));
+		State = NewState;
+	}
+
+	const int32 PatternId = Patterns.Add(Pattern);
+	PatternIds.Add(Pattern, PatternId);
+	Outputs[State].Add(PatternId);
+
+	return PatternId;
+}
+
+void FAssetNamingRules::BuildFailLinks()
+/*
+	States are visited in order of depth, so the failure state of a state (always shallower) has its own
+	failure link and merged outputs by the time it is needed
+*/
+{
+	TArray<int32> Queue;
+	Queue.Reserve(FailLinks.Num());
+
+	for (const TPair<TCHAR, int32>& Edge : Children[0])
+	{
+		FailLinks[Edge.Value] = 0;
+		Queue.Add(Edge.Value);
+	}
+
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+	{
+		const int32 State = Queue[QueueIndex];
+
+		for (const TPair<TCHAR, int32>& Edge : Children[State])
+		{
+			const int32 Child = Edge.Value;
+			const int32 FailState = Step(FailLinks[State], Edge.Key);
+
+			FailLinks[Child] = FailState;
+			Outputs[Child].Append(Outputs[FailState]);
+
+			Queue.Add(Child);
+		}
+	}
+
+	Children.Empty();
+}
+
+int32 FAssetNamingRules::Step(int32 State, TCHAR Char) const
+{
+	for (;;)
+	{
+		if (const int32* NextState = Transitions.Find(MakeTransitionKey(State, Char)))
+		{
+			return *NextState;
+		}
+
+		if (State == 0) return 0;
+
+		State = FailLinks[State];
+	}
+}
+
+#pragma endregion
+
+#pragma region Scopes
+
+void FAssetNamingRules::Compile(const UAssetActionsNamingSettings& Settings)
+/*
+	Add every configured string to the automaton once, then resolve the rule scopes to pattern ids
+*/
+{
+	Patterns.Reset();
+	PatternIds.Reset();
+	Transitions.Reset();
+	Scopes.Reset();
+	ScopeByPackagePath.Reset();
+
+	// State 0 is the root
+	Children.Init(TArray<TPair<TCHAR, int32>>(), 1);
+	FailLinks.Init(0, 1);
+	Outputs.Init(TArray<int32>(), 1);
+
+	Scopes.SetNum(1 + Settings.FolderOverrides.Num());
+	CompileScope(Scopes[0], Settings.ClassRules, Settings.ForbiddenSubstrings);
+
+	for (int32 OverrideIndex = 0; OverrideIndex < Settings.FolderOverrides.Num(); ++OverrideIndex)
+	{
+		const FAssetNamingFolderOverride& FolderOverride = Settings.FolderOverrides[OverrideIndex];
+		FNamingScope& Scope = Scopes[OverrideIndex + 1];
+
+		Scope.FolderPath = FolderOverride.FolderPath;
+		Scope.FolderPath.RemoveFromEnd(TEXT("/"));
+
+		TArray<FString> ForbiddenSubstrings = Settings.ForbiddenSubstrings;
+		ForbiddenSubstrings.Append(FolderOverride.ForbiddenSubstrings);
+
+		CompileScope(Scope, FolderOverride.ClassRules, ForbiddenSubstrings);
+	}
+
+	BuildFailLinks();
+
+	for (FNamingScope& Scope : Scopes)
+	{
+		if (Scope.ForbiddenPatterns.Num() < Patterns.Num())
+		{
+			Scope.ForbiddenPatterns.Add(false, Patterns.Num() - Scope.ForbiddenPatterns.Num());
+		}
+	}
+}
+
+void FAssetNamingRules::CompileScope(FNamingScope& Scope, const TArray<FAssetNamingClassRule>& ClassRules, const TArray<FString>& ForbiddenSubstrings)
+{
+	for (const FAssetNamingClassRule& ClassRule : ClassRules)
+	{
+		const FName ClassName(*ClassRule.ClassName);
+
+		if (Scope.ClassRules.Contains(ClassName))
+		{
+			DebugHelper::PrintLog("Naming rule for " + ClassRule.ClassName + " is listed more than once; using the last one");
+		}
+
+		FClassNamingRule& CompiledRule = Scope.ClassRules.Add(ClassName);
+
+		if (!ClassRule.Prefix.IsEmpty())
+		{
+			CompiledRule.PrefixPattern = AddPattern(ClassRule.Prefix);
+		}
+
+		if (!ClassRule.Suffix.IsEmpty())
+		{
+			CompiledRule.SuffixPattern = AddPattern(ClassRule.Suffix);
+		}
+	}
+
+	for (const FString& ForbiddenSubstring : ForbiddenSubstrings)
+	{
+		if (ForbiddenSubstring.IsEmpty()) continue;
+
+		const int32 PatternId = AddPattern(ForbiddenSubstring);
+
+		if (Scope.ForbiddenPatterns.Num() <= PatternId)
+		{
+			Scope.ForbiddenPatterns.Add(false, PatternId + 1 - Scope.ForbiddenPatterns.Num());
+		}
+
+		Scope.ForbiddenPatterns[PatternId] = true;
+	}
+}
+
+void FAssetNamingRules::ResetClassCache()
+{
+	for (FNamingScope& Scope : Scopes)
+	{
+		Scope.ResolvedRules.Reset();
+	}
+}
+
+void FAssetNamingRules::SetCatalog(const IAssetActionsCatalog* InCatalog)
+{
+	Catalog = InCatalog;
+	ResetClassCache();
+}
+
+int32 FAssetNamingRules::FindScope(const FName& PackagePath)
+/*
+	Pick the override with the longest folder path that is the package path or one of its parents;
+	the result is cached per package path
+*/
+{
+	if (const int32* ScopeIndex = ScopeByPackagePath.Find(PackagePath))
+	{
+		return *ScopeIndex;
+	}
+
+	const FString PackagePathString = PackagePath.ToString();
+
+	int32 BestScope = 0;
+	int32 BestFolderLength = 0;
+
+	for (int32 ScopeIndex = 1; ScopeIndex < Scopes.Num(); ++ScopeIndex)
+	{
+		const FString& FolderPath = Scopes[ScopeIndex].FolderPath;
+
+		if (FolderPath.Len() <= BestFolderLength) continue;
+
+		const bool bInFolder = PackagePathString.StartsWith(FolderPath) &&
+			(PackagePathString.Len() == FolderPath.Len() || PackagePathString[FolderPath.Len()] == TEXT('/'));
+
+		if (bInFolder)
+		{
+			BestScope = ScopeIndex;
+			BestFolderLength = FolderPath.Len();
+		}
+	}
+
+	ScopeByPackagePath.Add(PackagePath, BestScope);
+
+	return BestScope;
+}
+
+const FAssetNamingRules::FClassNamingRule* FAssetNamingRules::FindConfiguredRule(const FName& ClassName, int32 ScopeIndex) const
+{
+	if (const FClassNamingRule* ClassRule = Scopes[ScopeIndex].ClassRules.Find(ClassName))
+	{
+		return ClassRule;
+	}
+
+	return ScopeIndex != 0 ? Scopes[0].ClassRules.Find(ClassName) : nullptr;
+}
+
+const FAssetNamingRules::FClassNamingRule& FAssetNamingRules::ResolveClassRule(const FTopLevelAssetPath& ClassPath, int32 ScopeIndex)
+{
+	if (const FClassNamingRule* ResolvedRule = Scopes[ScopeIndex].ResolvedRules.Find(ClassPath))
+	{
+		return *ResolvedRule;
+	}
+
+	FClassNamingRule ResolvedRule;
+
+	if (const FClassNamingRule* ClassRule = FindConfiguredRule(ClassPath.GetAssetName(), ScopeIndex))
+	{
+		ResolvedRule = *ClassRule;
+	}
+
+	else if (Catalog)
+	{
+		TArray<FTopLevelAssetPath> AncestorClassPaths;
+		Catalog->GetAncestorClassPaths(ClassPath, AncestorClassPaths);
+
+		for (const FTopLevelAssetPath& AncestorClassPath : AncestorClassPaths)
+		{
+			if (const FClassNamingRule* ClassRule = FindConfiguredRule(AncestorClassPath.GetAssetName(), ScopeIndex))
+			{
+				ResolvedRule = *ClassRule;
+				break;
+			}
+		}
+	}
+
+	return Scopes[ScopeIndex].ResolvedRules.Add(ClassPath, ResolvedRule);
+}
+
+#pragma endregion
+
+EAssetNamingViolation FAssetNamingRules::CheckName(const FName& AssetName, const FTopLevelAssetPath& ClassPath, const FName& PackagePath)
+{
+	if (Scopes.IsEmpty()) return EAssetNamingViolation::None;
+
+	const int32 ScopeIndex = FindScope(PackagePath);
+	const FClassNamingRule ClassRule = ResolveClassRule(ClassPath, ScopeIndex);
+
+	return CheckNameInScope(AssetName, ClassRule, ScopeIndex);
+}
+
+void FAssetNamingRules::Resolve(const FTopLevelAssetPath& ClassPath, const FName& PackagePath)
+{
+	if (Scopes.IsEmpty()) return;
+
+	ResolveClassRule(ClassPath, FindScope(PackagePath));
+}
+
+EAssetNamingViolation FAssetNamingRules::CheckResolvedName(const FName& AssetName, const FTopLevelAssetPath& ClassPath, const FName& PackagePath) const
+/*
+	Same as CheckName but only reads the caches filled by Resolve, so it never writes to shared state
+*/
+{
+	if (Scopes.IsEmpty()) return EAssetNamingViolation::None;
+
+	const int32 ScopeIndex = ScopeByPackagePath.FindChecked(PackagePath);
+
+	return CheckNameInScope(AssetName, Scopes[ScopeIndex].ResolvedRules.FindChecked(ClassPath), ScopeIndex);
+}
+
+EAssetNamingViolation FAssetNamingRules::CheckNameInScope(const FName& AssetName, const FClassNamingRule& ClassRule, int32 ScopeIndex) const
+/*
+	Run the name through the automaton once. A match of the required prefix that starts at the first character,
+	a match of the required suffix that ends at the last character, or a match of any pattern forbidden in the
+	scope is recorded as it is found.
+*/
+{
+	const TBitArray<>& ForbiddenPatterns = Scopes[ScopeIndex].ForbiddenPatterns;
+
+	bool bPrefixFound = ClassRule.PrefixPattern == INDEX_NONE;
+	bool bSuffixFound = ClassRule.SuffixPattern == INDEX_NONE;
+	bool bForbiddenFound = false;
+
+	// Build the name on the stack; this runs once per listed asset
+	const FNameBuilder NameBuilder(AssetName);
+	const FStringView Name = NameBuilder.ToView();
+
+	int32 State = 0;
+
+	for (int32 CharIndex = 0; CharIndex < Name.Len(); ++CharIndex)
+	{
+		State = Step(State, FChar::ToLower(Name[CharIndex]));
+
+		for (const int32 PatternId : Outputs[State])
+		{
+			if (PatternId == ClassRule.PrefixPattern && CharIndex + 1 == Patterns[PatternId].Len())
+			{
+				bPrefixFound = true;
+			}
+
+			if (PatternId == ClassRule.SuffixPattern && CharIndex + 1 == Name.Len())
+			{
+				bSuffixFound = true;
+			}
+
+			bForbiddenFound |= ForbiddenPatterns[PatternId];
+		}
+	}
+
+	EAssetNamingViolation Violations = EAssetNamingViolation::None;
+
+	if (!bPrefixFound) Violations |= EAssetNamingViolation::MissingPrefix;
+	if (!bSuffixFound) Violations |= EAssetNamingViolation::MissingSuffix;
+	if (bForbiddenFound) Violations |= EAssetNamingViolation::ForbiddenSubstring;
+
+	return Violations;
+}
+
+const FString* FAssetNamingRules::FindPrefix(const FTopLevelAssetPath& ClassPath, const FName& PackagePath)
+{
+	if (Scopes.IsEmpty()) return nullptr;
+
+	const FClassNamingRule& ClassRule = ResolveClassRule(ClassPath, FindScope(PackagePath));
+
+	return ClassRule.PrefixPattern != INDEX_NONE ? &Patterns[ClassRule.PrefixPattern] : nullptr;
+}
@@ -0,0 +1,260 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Commandlets/AssetActionsAuditCommandlet.h"
+#include "AssetActionsManager.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAssetActionsAudit, Log, All);
+
+namespace AssetActionsAudit
+{
+	static const FString Unused(TEXT("Unused"));
+	static const FString DuplicateName(TEXT("DuplicateName"));
+	static const FString NamingViolation(TEXT("NamingViolation"));
+
+	/** Exit codes returned from Main */
+	static constexpr int32 Passed = 0;
+	static constexpr int32 ThresholdExceeded = 1;
+	static constexpr int32 Failed = 2;
+}
+
+UAssetActionsAuditCommandlet::UAssetActionsAuditCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAssetActionsAuditCommandlet::Main(const FString& Params)
+/*
+	Enumerate the folders into the manager's asset table, run the same filters the tab uses over every row,
+	then write the reports and compare each count against its threshold
+*/
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	auto GetParam = [&ParamsMap](const TCHAR* Key, const FString& DefaultValue)
+		{
+			const FString* Value = ParamsMap.Find(Key);
+			return Value ? *Value : DefaultValue;
+		};
+
+	TArray<FString> FolderPaths;
+	GetParam(TEXT("Paths"), TEXT("/Game")).ParseIntoArray(FolderPaths, TEXT("+"));
+
+	const FString OutputDir = GetParam(TEXT("Output"), FPaths::ProjectSavedDir() / TEXT("AssetActionsAudit"));
+	const FString Format = GetParam(TEXT("Format"), TEXT("both"));
+
+	const bool bWriteJson = Format == TEXT("json") || Format == TEXT("both");
+	const bool bWriteCsv = Format == TEXT("csv") || Format == TEXT("both");
+
+	if (FolderPaths.IsEmpty() || (!bWriteJson && !bWriteCsv))
+	{
+		UE_LOG(LogAssetActionsAudit, Error, TEXT("Expected -Paths=/Game/A+/Game/B and -Format=json|csv|both"));
+		return AssetActionsAudit::Failed;
+	}
+
+	const TPair<const TCHAR*, FString> Thresholds[] =
+	{
+		{ TEXT("MaxUnused"), AssetActionsAudit::Unused },
+		{ TEXT("MaxDuplicateNames"), AssetActionsAudit::DuplicateName },
+		{ TEXT("MaxNamingViolations"), AssetActionsAudit::NamingViolation },
+	};
+
+	// A threshold that is not a number would otherwise parse as 0 and fail every audit with any finding
+	for (const TPair<const TCHAR*, FString>& Threshold : Thresholds)
+	{
+		const FString* MaxCountParam = ParamsMap.Find(Threshold.Key);
+
+		if (MaxCountParam && (MaxCountParam->IsEmpty() || !FCString::IsNumeric(**MaxCountParam)))
+		{
+			UE_LOG(LogAssetActionsAudit, Error, TEXT("Expected a number for -%s, got '%s'"), Threshold.Key, **MaxCountParam);
+			return AssetActionsAudit::Failed;
+		}
+	}
+
+	// The registry is still gathering when a commandlet starts; the audit needs the full project
+	IAssetRegistry::GetChecked().SearchAllAssets(true);
+
+	FAssetActionsManagerModule& AssetActionsManager =
+		FModuleManager::LoadModuleChecked<FAssetActionsManagerModule>(TEXT("AssetActionsManager"));
+
+	AssetActionsManager.RefreshAssetTableForFolders(FolderPaths);
+
+	const FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+	const TBitArray<>& AllRows = AssetTable.GetLiveRows();
+
+	UE_LOG(LogAssetActionsAudit, Display, TEXT("Auditing %d assets under %s"), AssetTable.Num(), *FString::Join(FolderPaths, TEXT(", ")));
+
+	TArray<FAuditEntry> Entries;
+	TMap<FString, int32> Counts;
+
+	const TBitArray<> UnusedRows = AssetActionsManager.FilterAssetTable(EAssetActionsFilter::Unused, AllRows);
+
+	for (TConstSetBitIterator<> It(UnusedRows); It; ++It)
+	{
+		Entries.Add({ AssetActionsAudit::Unused, It.GetIndex(), FString() });
+	}
+
+	Counts.Add(AssetActionsAudit::Unused, Entries.Num());
+
+	const TArray<TArray<int32>> DuplicateGroups = AssetActionsManager.GroupDuplicateNames(AllRows);
+	int32 NumDuplicateRows = 0;
+
+	for (int32 GroupIndex = 0; GroupIndex < DuplicateGroups.Num(); ++GroupIndex)
+	{
+		for (const int32 Row : DuplicateGroups[GroupIndex])
+		{
+			Entries.Add({ AssetActionsAudit::DuplicateName, Row, FString::FromInt(GroupIndex) });
+			++NumDuplicateRows;
+		}
+	}
+
+	Counts.Add(AssetActionsAudit::DuplicateName, NumDuplicateRows);
+
+	const TBitArray<> NamingViolationRows = AssetActionsManager.FilterAssetTable(EAssetActionsFilter::NamingViolation, AllRows);
+	int32 NumNamingViolations = 0;
+
+	for (TConstSetBitIterator<> It(NamingViolationRows); It; ++It)
+	{
+		const FString Violations = DescribeNamingViolations(AssetActionsManager.GetNamingViolations(It.GetIndex()));
+		Entries.Add({ AssetActionsAudit::NamingViolation, It.GetIndex(), Violations });
+		++NumNamingViolations;
+	}
+
+	Counts.Add(AssetActionsAudit::NamingViolation, NumNamingViolations);
+
+	// Reports
+	const FString ReportBaseName = OutputDir / TEXT("AssetActionsAudit");
+
+	if (bWriteJson && !WriteJsonReport(ReportBaseName + TEXT(".json"), Entries, Counts))
+	{
+		return AssetActionsAudit::Failed;
+	}
+
+	if (bWriteCsv && !WriteCsvReport(ReportBaseName + TEXT(".csv"), Entries))
+	{
+		return AssetActionsAudit::Failed;
+	}
+
+	// Thresholds
+	int32 ExitCode = AssetActionsAudit::Passed;
+
+	for (const TPair<const TCHAR*, FString>& Threshold : Thresholds)
+	{
+		const int32 Count = Counts.FindChecked(Threshold.Value);
+		const FString* MaxCountParam = ParamsMap.Find(Threshold.Key);
+
+		if (MaxCountParam && Count > FCString::Atoi(**MaxCountParam))
+		{
+			UE_LOG(LogAssetActionsAudit, Error, TEXT("%s: %d assets, threshold is %s"), *Threshold.Value, Count, **MaxCountParam);
+			ExitCode = AssetActionsAudit::ThresholdExceeded;
+		}
+
+		else
+		{
+			UE_LOG(LogAssetActionsAudit, Display, TEXT("%s: %d assets"), *Threshold.Value, Count);
+		}
+	}
+
+	return ExitCode;
+}
+
+bool UAssetActionsAuditCommandlet::WriteJsonReport(const FString& Filename, const TArray<FAuditEntry>& Entries, const TMap<FString, int32>& Counts) const
+{
+	FAssetActionsManagerModule& AssetActionsManager =
+		FModuleManager::GetModuleChecked<FAssetActionsManagerModule>(TEXT("AssetActionsManager"));
+
+	const FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+
+	TSharedRef<FJsonObject> CountsObject = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, int32>& Count : Counts)
+	{
+		CountsObject->SetNumberField(Count.Key, Count.Value);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> EntryValues;
+	EntryValues.Reserve(Entries.Num());
+
+	for (const FAuditEntry& Entry : Entries)
+	{
+		const FAssetData& AssetData = *AssetTable.GetItem(Entry.Row);
+
+		TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetStringField(TEXT("audit"), Entry.Audit);
+		EntryObject->SetStringField(TEXT("objectPath"), AssetData.GetObjectPathString());
+		EntryObject->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
+		EntryObject->SetStringField(TEXT("detail"), Entry.Detail);
+
+		EntryValues.Add(MakeShared<FJsonValueObject>(EntryObject));
+	}
+
+	TSharedRef<FJsonObject> ReportObject = MakeShared<FJsonObject>();
+	ReportObject->SetNumberField(TEXT("assetCount"), AssetTable.Num());
+	ReportObject->SetObjectField(TEXT("counts"), CountsObject);
+	ReportObject->SetArrayField(TEXT("entries"), EntryValues);
+
+	FString ReportText;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&ReportText);
+
+	if (!FJsonSerializer::Serialize(ReportObject, JsonWriter) || !FFileHelper::SaveStringToFile(ReportText, *Filename))
+	{
+		UE_LOG(LogAssetActionsAudit, Error, TEXT("Failed to write %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogAssetActionsAudit, Display, TEXT("Wrote %s"), *Filename);
+	return true;
+}
+
+bool UAssetActionsAuditCommandlet::WriteCsvReport(const FString& Filename, const TArray<FAuditEntry>& Entries) const
+/*
+	Object paths, class paths and details never contain commas or quotes, so fields are written unquoted
+*/
+{
+	FAssetActionsManagerModule& AssetActionsManager =
+		FModuleManager::GetModuleChecked<FAssetActionsManagerModule>(TEXT("AssetActionsManager"));
+
+	const FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+
+	TArray<FString> Lines;
+	Lines.Reserve(Entries.Num() + 1);
+	Lines.Add(TEXT("Audit,ObjectPath,Class,Detail"));
+
+	for (const FAuditEntry& Entry : Entries)
+	{
+		const FAssetData& AssetData = *AssetTable.GetItem(Entry.Row);
+
+		Lines.Add(FString::Printf(TEXT("%s,%s,%s,%s"), *Entry.Audit, *AssetData.GetObjectPathString(),
+			*AssetData.AssetClassPath.ToString(), *Entry.Detail));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *Filename))
+	{
+		UE_LOG(LogAssetActionsAudit, Error, TEXT("Failed to write %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogAssetActionsAudit, Display, TEXT("Wrote %s"), *Filename);
+	return true;
+}
+
+FString UAssetActionsAuditCommandlet::DescribeNamingViolations(EAssetNamingViolation Violations)
+{
+	TArray<FString> ViolationNames;
+
+	if (EnumHasAnyFlags(Violations, EAssetNamingViolation::MissingPrefix)) ViolationNames.Add(TEXT("MissingPrefix"));
+	if (EnumHasAnyFlags(Violations, EAssetNamingViolation::MissingSuffix)) ViolationNames.Add(TEXT("MissingSuffix"));
+	if (EnumHasAnyFlags(Violations, EAssetNamingViolation::ForbiddenSubstring)) ViolationNames.Add(TEXT("ForbiddenSubstring"));
+
+	return FString::Join(ViolationNames, TEXT("|"));
+}
@@ -0,0 +1,330 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Commandlets/AssetActionsBenchmarkCommandlet.h"
+#include "AssetActionsManager.h"
+#include "AssetActionsMemoryCatalog.h"
+#include "AssetActionsReachability.h"
+#include "AssetActionsRegistryCatalog.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAssetActionsBenchmark, Log, All);
+
+UAssetActionsBenchmarkCommandlet::UAssetActionsBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAssetActionsBenchmarkCommandlet::Main(const FString& Params)
+/*
+	Every size installs a synthetic catalog on the manager and runs the stages the tab runs against it.
+	Sorting and row generation live in the Slate widget and are timed by the widget benchmark automation test.
+*/
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	auto GetParam = [&ParamsMap](const TCHAR* Key, const FString& DefaultValue)
+		{
+			const FString* Value = ParamsMap.Find(Key);
+			return Value ? *Value : DefaultValue;
+		};
+
+	TArray<FString> SizeStrings;
+	GetParam(TEXT("Sizes"), TEXT("1000+10000+100000")).ParseIntoArray(SizeStrings, TEXT("+"));
+
+	const int32 Iterations = FMath::Max(FCString::Atoi(*GetParam(TEXT("Iterations"), TEXT("5"))), 1);
+	const FString OutputDir = GetParam(TEXT("Output"), GetDefaultOutputDir());
+
+	FAssetActionsManagerModule& AssetActionsManager =
+		FModuleManager::LoadModuleChecked<FAssetActionsManagerModule>(TEXT("AssetActionsManager"));
+
+	FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+
+	TArray<TSharedPtr<FJsonValue>> ReportValues;
+	TMap<FString, FStageResult> PreviousResults;
+
+	auto Report = [&ReportValues, &PreviousResults](const FStageResult& Result)
+		{
+			ReportStage(Result, PreviousResults.Find(Result.Stage), ReportValues);
+			PreviousResults.Add(Result.Stage, Result);
+		};
+
+	// Real enumeration is timed once against the project's content when folders are given
+	if (const FString* PathsParam = ParamsMap.Find(TEXT("Paths")))
+	{
+		TArray<FString> FolderPaths;
+		PathsParam->ParseIntoArray(FolderPaths, TEXT("+"));
+
+		IAssetRegistry::GetChecked().SearchAllAssets(true);
+
+		Report(RunStage(TEXT("EnumerateFolders"), 0, Iterations, [] {},
+			[&AssetActionsManager, &FolderPaths] { AssetActionsManager.RefreshAssetTableForFolders(FolderPaths); }));
+	}
+
+	for (const FString& SizeString : SizeStrings)
+	{
+		const int32 NumAssets = FCString::Atoi(*SizeString);
+
+		if (NumAssets <= 0) continue;
+
+		const TSharedRef<FAssetActionsMemoryCatalog> Catalog = GenerateCatalog(NumAssets);
+		AssetActionsManager.SetCatalog(Catalog);
+
+		const TArray<FString> SyntheticFolderPaths = { TEXT("/Game/Benchmark") };
+
+		Report(RunStage(TEXT("EnumerateCatalog"), NumAssets, Iterations, [] {},
+			[&AssetActionsManager, &SyntheticFolderPaths] { AssetActionsManager.RefreshAssetTableForFolders(SyntheticFolderPaths); }));
+
+		const TBitArray<> AllRows = AssetTable.GetLiveRows();
+
+		TArray<FSoftObjectPath> ObjectPaths;
+		ObjectPaths.Reserve(AssetTable.Num());
+
+		for (TConstSetBitIterator<> It(AllRows); It; ++It)
+		{
+			ObjectPaths.Add(AssetTable.GetItem(It.GetIndex())->GetSoftObjectPath());
+		}
+
+		Report(RunStage(TEXT("FindRowByObjectPath"), NumAssets, Iterations, [] {},
+			[&AssetTable, &ObjectPaths]
+			{
+				for (const FSoftObjectPath& ObjectPath : ObjectPaths)
+				{
+					AssetTable.FindRow(ObjectPath);
+				}
+			}));
+
+		Report(RunStage(TEXT("FilterForUnusedAssetData"), NumAssets, Iterations, [] {},
+			[&AssetActionsManager, &AllRows] { AssetActionsManager.FilterAssetTable(EAssetActionsFilter::Unused, AllRows); }));
+
+		// Mark from every sixth row so part of the graph is left unreached
+		TArray<FName> RootPackages;
+
+		for (TConstSetBitIterator<> It(AllRows); It; ++It)
+		{
+			if (It.GetIndex() % 6 == 0)
+			{
+				RootPackages.Add(AssetTable.GetPackageName(It.GetIndex()));
+			}
+		}
+
+		FAssetActionsReachability Reachability;
+
+		Report(RunStage(TEXT("MarkReachable"), NumAssets, Iterations, [] {},
+			[&Reachability, &Catalog, &RootPackages] { Reachability.Build(*Catalog, RootPackages); }));
+
+		Report(RunStage(TEXT("FilterForDuplicateNameData"), NumAssets, Iterations, [] {},
+			[&AssetActionsManager, &AllRows] { AssetActionsManager.FilterAssetTable(EAssetActionsFilter::DuplicateName, AllRows); }));
+
+		Report(RunStage(TEXT("GroupDuplicateNames"), NumAssets, Iterations, [] {},
+			[&AssetActionsManager, &AllRows] { AssetActionsManager.GroupDuplicateNames(AllRows); }));
+
+		Report(RunStage(TEXT("FilterForNamingViolations"), NumAssets, Iterations, [] {},
+			[&AssetActionsManager, &AllRows] { AssetActionsManager.FilterAssetTable(EAssetActionsFilter::NamingViolation, AllRows); }));
+	}
+
+	// Put the project back rather than holding the largest synthetic catalog
+	AssetActionsManager.SetCatalog(MakeShared<FAssetActionsRegistryCatalog>());
+
+	return WriteReport(TEXT("Manager"), ReportValues, Iterations, OutputDir) ? 0 : 1;
+}
+
+TSharedRef<FAssetActionsMemoryCatalog> UAssetActionsBenchmarkCommandlet::GenerateCatalog(int32 NumAssets)
+{
+	static const TPair<const TCHAR*, const TCHAR*> ClassesAndPrefixes[] =
+	{
+		{ TEXT("/Script/Engine.StaticMesh"), TEXT("SM_") },
+		{ TEXT("/Script/Engine.Texture2D"), TEXT("T_") },
+		{ TEXT("/Script/Engine.Material"), TEXT("M_") },
+		{ TEXT("/Script/Engine.MaterialInstanceConstant"), TEXT("MI_") },
+		{ TEXT("/Script/Engine.SoundWave"), TEXT("SFX_") },
+		{ TEXT("/Script/Engine.Blueprint"), TEXT("BP_") },
+	};
+
+	constexpr int32 AssetsPerFolder = 100;
+
+	TSharedRef<FAssetActionsMemoryCatalog> Catalog = MakeShared<FAssetActionsMemoryCatalog>();
+	Catalog->Reserve(NumAssets);
+
+	FName PreviousPackageName;
+
+	for (int32 Index = 0; Index < NumAssets; ++Index)
+	{
+		const TPair<const TCHAR*, const TCHAR*>& ClassAndPrefix = ClassesAndPrefixes[Index % UE_ARRAY_COUNT(ClassesAndPrefixes)];
+
+		// Every tenth asset reuses the name of an asset in the previous folder
+		const int32 NameIndex = (Index % 10 == 9 && Index >= AssetsPerFolder) ? Index - AssetsPerFolder : Index;
+		const TCHAR* Prefix = NameIndex % 4 == 3 ? TEXT("") : ClassAndPrefix.Value;
+
+		const FString PackagePath = FString::Printf(TEXT("/Game/Benchmark/Folder%04d"), Index / AssetsPerFolder);
+		const FString AssetName = FString::Printf(TEXT("%sAsset%07d"), Prefix, NameIndex);
+
+		const FName PackageName(PackagePath / AssetName);
+		Catalog->AddAsset(FAssetData(PackageName, FName(PackagePath), FName(AssetName), FTopLevelAssetPath(ClassAndPrefix.Key)));
+
+		// Chain most assets to the one before them; every third asset is left without a referencer
+		if (Index % 3 != 0)
+		{
+			Catalog->AddReference(PreviousPackageName, PackageName);
+		}
+
+		PreviousPackageName = PackageName;
+	}
+
+	return Catalog;
+}
+
+UAssetActionsBenchmarkCommandlet::FStageResult UAssetActionsBenchmarkCommandlet::RunStage(const FString& Stage, int32 NumAssets, int32 Iterations,
+	TFunctionRef<void()> Setup, TFunctionRef<void()> StageBody)
+/*
+	The first run includes cache misses (referencer and class rule caches, name table growth), later runs show
+	the steady state the tab sees when a filter is reapplied
+*/
+{
+	FStageResult Result;
+	Result.Stage = Stage;
+	Result.NumAssets = NumAssets;
+	Result.BestMilliseconds = TNumericLimits<double>::Max();
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Setup();
+
+		const uint64 UsedPhysicalBefore = FPlatformMemory::GetStats().UsedPhysical;
+		const uint64 MallocCallsBefore = GetMallocCalls();
+		const double StartTime = FPlatformTime::Seconds();
+
+		StageBody();
+
+		const double Milliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		if (Iteration == 0)
+		{
+			Result.ColdMilliseconds = Milliseconds;
+			Result.UsedPhysicalDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(UsedPhysicalBefore);
+
+			if (IsCountingMallocCalls())
+			{
+				Result.MallocCalls = static_cast<int64>(GetMallocCalls() - MallocCallsBefore);
+			}
+		}
+
+		Result.BestMilliseconds = FMath::Min(Result.BestMilliseconds, Milliseconds);
+	}
+
+	return Result;
+}
+
+void UAssetActionsBenchmarkCommandlet::ReportStage(const FStageResult& Result, const FStageResult* PreviousResult, TArray<TSharedPtr<FJsonValue>>& OutReportValues)
+{
+	const double NanosecondsPerAsset = Result.NumAssets > 0 ? Result.BestMilliseconds * 1.0e6 / Result.NumAssets : 0.0;
+
+	TSharedRef<FJsonObject> StageObject = MakeShared<FJsonObject>();
+	StageObject->SetStringField(TEXT("stage"), Result.Stage);
+	StageObject->SetNumberField(TEXT("assets"), Result.NumAssets);
+	StageObject->SetNumberField(TEXT("coldMs"), Result.ColdMilliseconds);
+	StageObject->SetNumberField(TEXT("bestMs"), Result.BestMilliseconds);
+	StageObject->SetNumberField(TEXT("nsPerAsset"), NanosecondsPerAsset);
+	StageObject->SetNumberField(TEXT("usedPhysicalDeltaBytes"), static_cast<double>(Result.UsedPhysicalDelta));
+
+	FString MallocCallsText = TEXT("n/a");
+
+	if (Result.MallocCalls != INDEX_NONE)
+	{
+		StageObject->SetNumberField(TEXT("mallocCalls"), static_cast<double>(Result.MallocCalls));
+		MallocCallsText = FString::Printf(TEXT("%lld"), Result.MallocCalls);
+	}
+
+	FString GrowthText;
+
+	if (PreviousResult && PreviousResult->NumAssets > 0 && PreviousResult->BestMilliseconds > 0.0)
+	{
+		const double SizeRatio = static_cast<double>(Result.NumAssets) / PreviousResult->NumAssets;
+		const double TimeRatio = Result.BestMilliseconds / PreviousResult->BestMilliseconds;
+
+		StageObject->SetNumberField(TEXT("sizeRatio"), SizeRatio);
+		StageObject->SetNumberField(TEXT("timeRatio"), TimeRatio);
+
+		GrowthText = FString::Printf(TEXT(", x%.1f time for x%.1f assets"), TimeRatio, SizeRatio);
+	}
+
+	OutReportValues.Add(MakeShared<FJsonValueObject>(StageObject));
+
+	UE_LOG(LogAssetActionsBenchmark, Display, TEXT("%-28s %8d assets: cold %9.3f ms, best %9.3f ms, %8.1f ns/asset, %s allocs%s"),
+		*Result.Stage, Result.NumAssets, Result.ColdMilliseconds, Result.BestMilliseconds, NanosecondsPerAsset, *MallocCallsText, *GrowthText);
+}
+
+bool UAssetActionsBenchmarkCommandlet::WriteReport(const FString& Suite, const TArray<TSharedPtr<FJsonValue>>& ReportValues, int32 Iterations, 
+	const FString& OutputDir)
+{
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AssetActionsManager"));
+
+	TSharedRef<FJsonObject> ReportObject = MakeShared<FJsonObject>();
+	ReportObject->SetStringField(TEXT("suite"), Suite);
+	ReportObject->SetStringField(TEXT("pluginVersion"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString());
+	ReportObject->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	ReportObject->SetNumberField(TEXT("iterations"), Iterations);
+	ReportObject->SetBoolField(TEXT("countsMallocCalls"), IsCountingMallocCalls());
+	ReportObject->SetArrayField(TEXT("stages"), ReportValues);
+
+	const FString Filename = OutputDir / FString::Printf(TEXT("AssetActionsBenchmark-%s-%s.json"), *Suite, *FDateTime::UtcNow().ToString());
+
+	FString ReportText;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&ReportText);
+
+	if (!FJsonSerializer::Serialize(ReportObject, JsonWriter) || !FFileHelper::SaveStringToFile(ReportText, *Filename))
+	{
+		UE_LOG(LogAssetActionsBenchmark, Error, TEXT("Failed to write %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogAssetActionsBenchmark, Display, TEXT("Wrote %s"), *Filename);
+	return true;
+}
+
+FString UAssetActionsBenchmarkCommandlet::GetDefaultOutputDir()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetActionsBenchmark");
+}
+
+bool UAssetActionsBenchmarkCommandlet::IsCountingMallocCalls()
+/*
+	The counter only moves for allocators that implement it, so a counter that stays still over an allocation 
+	means the stage counts would all read zero
+*/
+{
+	static const bool bCountingMallocCalls = []()
+		{
+			const uint64 MallocCallsBefore = GetMallocCalls();
+
+			void* Probe = FMemory::Malloc(64);
+			const bool bCounted = GetMallocCalls() != MallocCallsBefore;
+			FMemory::Free(Probe);
+
+			return bCounted;
+		}();
+
+	return bCountingMallocCalls;
+}
+
+uint64 UAssetActionsBenchmarkCommandlet::GetMallocCalls()
+{
+#if STATS
+	return FMalloc::TotalMallocCalls.load() + FMalloc::TotalReallocCalls.load();
+#else
+	return 0;
+#endif
+}
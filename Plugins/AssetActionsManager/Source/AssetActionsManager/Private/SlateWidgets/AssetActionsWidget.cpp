@@ -4,11 +4,16 @@
 #include "SlateWidgets/AssetActionsWidget.h"
 
 #include "AssetActionsManager.h"
+#include "AssetActionsStats.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
 #include "DebugHelper.h"
 #include "Dialog/SCustomDialog.h"
 #include "SlateWidgets/RenameAssetDialog.h"
 #include "SlateWidgets/ReplaceStringDialog.h"
 #include "Widgets/Input/SNumericEntryBox.h"
+#include "Widgets/Notifications/SProgressBar.h"
 
 #define LOCTEXT_NAMESPACE "SAssetActionsTab"
 
@@ -20,7 +25,12 @@
 #define ListAll TEXT("List All Assets")
 #define ListUnused TEXT("List Unused Assets")
 #define ListDuplicate TEXT("List Duplicate Name Assets")
-#define ListNoPrefix TEXT("List Assets with No Prefix")
+#define ListNamingViolations TEXT("List Assets Breaking Naming Rules")
+
+DECLARE_CYCLE_STAT(TEXT("Update Sorting"), STAT_AssetActions_UpdateSorting, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Generate Row"), STAT_AssetActions_OnGenerateRowForListView, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Refresh Widget"), STAT_AssetActions_RefreshWidget, STATGROUP_AssetActions);
+DECLARE_CYCLE_STAT(TEXT("Time Sliced Filter"), STAT_AssetActions_TimeSlicedFilter, STATGROUP_AssetActions);
 
 void SAssetActionsTab::Construct(const FArguments& InArgs)
 /*
@@ -33,10 +43,13 @@ void SAssetActionsTab::Construct(const FArguments& InArgs)
 	FilterListItems.Empty();
 
 	// Grab data from manager
-	AllAssetsDataFromManager = InArgs._AllAssetsDataFromManager;
-	DisplayedAssetsData = AllAssetsDataFromManager; // set display data to all by default
-	UncheckedAssets = DisplayedAssetsData; // all assets are unchecked on spawn
 	SelectedFoldersPaths = InArgs._SelectedFoldersPaths; 
+	DisplayFilteredAssets(); // set display data to all by default
+	CheckedRows.Init(false, GetAssetTable().GetMaxRows()); // all assets are unchecked on spawn
+	NumCheckedRows = 0;
+
+	// Listen for asset changes so the list can be updated without a full refresh
+	AssetDataChangedHandle = LoadManagerModule().OnAssetDataChanged().AddSP(this, &SAssetActionsTab::OnAssetDataChanged);
 
 	AssetCountMsg = GetAssetCountMsg();
 
@@ -47,7 +60,7 @@ void SAssetActionsTab::Construct(const FArguments& InArgs)
 	FilterListItems.Add(MakeShared<FString>(ListAll));
 	FilterListItems.Add(MakeShared<FString>(ListUnused));
 	FilterListItems.Add(MakeShared<FString>(ListDuplicate));
-	FilterListItems.Add(MakeShared<FString>(ListNoPrefix));
+	FilterListItems.Add(MakeShared<FString>(ListNamingViolations));
 
 	ChildSlot
 		[
@@ -111,17 +124,13 @@ void SAssetActionsTab::Construct(const FArguments& InArgs)
 			]
 
 			// Third slot for list view
+			// The list view scrolls itself; wrapping it in a scroll box would give it unbounded height 
+			// and generate a row widget for every asset instead of only the visible ones
 			+ SVerticalBox::Slot()
 			.VAlign(VAlign_Fill)
 			.Padding(5.f)
 			[
-				SNew(SScrollBox)
-
-				// List View
-				+ SScrollBox::Slot()
-				[
-					ConstructAssetListView()
-				]
+				ConstructAssetListView()
 			]
 
 
@@ -148,11 +157,19 @@ void SAssetActionsTab::Construct(const FArguments& InArgs)
 				]
 			]
 
-			// Fifth slot for bulk action buttons 
+			// Fifth slot for bulk action progress; only visible while an action runs
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				ConstructJobProgress()
+			]
+
+			// Sixth slot for bulk action buttons 
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			[
 				SNew(SHorizontalBox)
+				.IsEnabled(this, &SAssetActionsTab::IsBulkActionIdle)
 				
 				// Add Prefix to Selected
 				+ SHorizontalBox::Slot()
@@ -188,11 +205,30 @@ void SAssetActionsTab::Construct(const FArguments& InArgs)
 
 		];
 
-		// only need to filter data if we haven't already
-		if (UnusedAssetsData.IsEmpty() || DuplicatedNameAssetsData.IsEmpty() || NoPrefixAssetsData.IsEmpty())
-		{
-			FilterAssetData();
-		}
+	// The manager lists the selected folders a time slice per frame when a budget is set
+	if (LoadManagerModule().IsEnumeratingAssetTable())
+	{
+		StartTimeSlicedLoad();
+	}
+}
+
+SAssetActionsTab::~SAssetActionsTab()
+/*
+	Unbind from the manager if it is still loaded
+*/
+{
+	if (FAssetActionsManagerModule* AssetActionsManager = 
+		FModuleManager::GetModulePtr<FAssetActionsManagerModule>(TEXT("AssetActionsManager")))
+	{
+		AssetActionsManager->OnAssetDataChanged().Remove(AssetDataChangedHandle);
+	}
+
+	// A running action stops at its last completed chunk when the tab closes
+	if (ActiveJob.IsValid())
+	{
+		ActiveJob->Cancel();
+		DebugHelper::PrintLog(ActiveJob->GetSummary());
+	}
 }
 
 #pragma region TitleBar
@@ -298,46 +334,76 @@ TSharedRef<SWidget> SAssetActionsTab::OnGenerateFilterItem(TSharedPtr<FString> F
 }
 
 // 
-void SAssetActionsTab::OnFilterSelectionChanged(TSharedPtr<FString> SelectedFilter, ESelectInfo::Type InSelectInfo)
+void SAssetActionsTab::OnFilterSelectionChanged(TSharedPtr<FString> SelectedFilterItem, ESelectInfo::Type InSelectInfo)
 /* 
 	Update ComboBox text and call appropriate filtering functions based on the user selected filter option 
 	@note: OnSelectionChange requires a selectinfo parameter (see SComboBox.h from source)
 */
 {
-	const FString SelectedFilterText = *SelectedFilter.Get();
+	const FString SelectedFilterText = *SelectedFilterItem.Get();
 
 	// Set ComboBox text to selected filter
 	ComboBoxDisplayedText->SetText(FText::FromString(SelectedFilterText));
 
-	// Display all assets
-	if (SelectedFilterText == ListAll)
+	if (SelectedFilterText == ListUnused)
 	{
-		DisplayedAssetsData = AllAssetsDataFromManager;
-		RefreshWidget();
+		SelectedFilter = EAssetActionsFilter::Unused;
 	}
 
-	// Display only unused assets 
-	else if (SelectedFilterText == ListUnused)
+	else if (SelectedFilterText == ListDuplicate)
 	{
-		DisplayedAssetsData = UnusedAssetsData;
-		RefreshWidget();
+		SelectedFilter = EAssetActionsFilter::DuplicateName;
 	}
 
-	// Display assets with duplicate names 
-	else if (SelectedFilterText == ListDuplicate)
+	else if (SelectedFilterText == ListNamingViolations)
+	{
+		SelectedFilter = EAssetActionsFilter::NamingViolation;
+	}
+
+	else
+	{
+		SelectedFilter = EAssetActionsFilter::All;
+	}
+
+	// During a load the rows listed so far are shown for all assets, and other filters start over once every 
+	// folder is listed
+	if (bTimeSlicedLoadActive)
 	{
-		// Filter items
-		DisplayedAssetsData = DuplicatedNameAssetsData;
-		RefreshWidget();
+		DisplayedAssetsData.Reset();
+
+		if (SelectedFilter == EAssetActionsFilter::All)
+		{
+			DisplayFilteredAssets();
+		}
+
+		if (!LoadManagerModule().IsEnumeratingAssetTable())
+		{
+			BeginTimeSlicedFilter();
+		}
+
+		RefreshListView();
+		TrackCheckBoxStateForHeader();
+		return;
 	}
 
-	// Display assets with no prefixes 
-	else if (SelectedFilterText == ListNoPrefix)
+	// With a frame budget, a filter without a memoized result is evaluated a time slice per frame like a load
+	if (!IsFilterResultCurrent(SelectedFilter) && LoadManagerModule().GetTimeSliceBudgetSeconds() > 0.0)
 	{
-		// Filter items
-		DisplayedAssetsData = NoPrefixAssetsData;
-		RefreshWidget();
+		DisplayedAssetsData.Reset();
+		BeginTimeSlicedFilter();
+
+		bTimeSlicedLoadActive = true;
+		RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SAssetActionsTab::TickTimeSlicedLoad));
+
+		RefreshListView();
+		TrackCheckBoxStateForHeader();
+		return;
 	}
+
+	// Filters only run the first time they are selected or after the listed assets changed
+	DisplayFilteredAssets();
+	RefreshListView();
+	TrackCheckBoxStateForHeader();
 }
 
 
@@ -386,7 +452,7 @@ TSharedRef<SListView<TSharedPtr<FAssetData>>> SAssetActionsTab::ConstructAssetLi
 		SNew(SListView<TSharedPtr<FAssetData>>)
 		.ItemHeight(24.f) // height of each row
 		.ListItemsSource(&DisplayedAssetsData) // pointer to array of source items
-		.OnGenerateRow(this, &SAssetActionsTab::OnGenerateRowForListView) // create row for every asset found
+		.OnGenerateRow(this, &SAssetActionsTab::OnGenerateRowForListView) // create row for every visible asset
 		.OnMouseButtonDoubleClick(this, &SAssetActionsTab::OnRowDoubleClick)
 		.HeaderRow
 		(
@@ -397,6 +463,7 @@ TSharedRef<SListView<TSharedPtr<FAssetData>>> SAssetActionsTab::ConstructAssetLi
 			.VAlignHeader(EVerticalAlignment::VAlign_Center)
 			.HAlignHeader(EHorizontalAlignment::HAlign_Center)
 			.SortMode(this, &SAssetActionsTab::GetSortModeForColumn, AssetActionsColumns::Checkbox)
+			.SortPriority(this, &SAssetActionsTab::GetSortPriorityForColumn, AssetActionsColumns::Checkbox)
 			.OnSort(this, &SAssetActionsTab::OnSortModeChanged)
 			[
 				ConstructCheckBoxForHeaderRow()
@@ -407,6 +474,7 @@ TSharedRef<SListView<TSharedPtr<FAssetData>>> SAssetActionsTab::ConstructAssetLi
 			.VAlignHeader(EVerticalAlignment::VAlign_Center)
 			.HAlignHeader(EHorizontalAlignment::HAlign_Center)
 			.SortMode(this, &SAssetActionsTab::GetSortModeForColumn, AssetActionsColumns::Class)
+			.SortPriority(this, &SAssetActionsTab::GetSortPriorityForColumn, AssetActionsColumns::Class)
 			.OnSort(this, &SAssetActionsTab::OnSortModeChanged)
 			[
 				ConstructTextForHeaderRow(TEXT("Asset Type"))
@@ -417,6 +485,7 @@ TSharedRef<SListView<TSharedPtr<FAssetData>>> SAssetActionsTab::ConstructAssetLi
 			.VAlignHeader(EVerticalAlignment::VAlign_Center)
 			.HAlignHeader(EHorizontalAlignment::HAlign_Center)
 			.SortMode(this, &SAssetActionsTab::GetSortModeForColumn, AssetActionsColumns::Name)
+			.SortPriority(this, &SAssetActionsTab::GetSortPriorityForColumn, AssetActionsColumns::Name)
 			.OnSort(this, &SAssetActionsTab::OnSortModeChanged)
 			[
 				ConstructTextForHeaderRow(TEXT("Asset Name"))
@@ -427,6 +496,7 @@ TSharedRef<SListView<TSharedPtr<FAssetData>>> SAssetActionsTab::ConstructAssetLi
 			.VAlignHeader(EVerticalAlignment::VAlign_Center)
 			.HAlignHeader(EHorizontalAlignment::HAlign_Center)
 			.SortMode(this, &SAssetActionsTab::GetSortModeForColumn, AssetActionsColumns::Path)
+			.SortPriority(this, &SAssetActionsTab::GetSortPriorityForColumn, AssetActionsColumns::Path)
 			.OnSort(this, &SAssetActionsTab::OnSortModeChanged)
 			[
 				ConstructTextForHeaderRow(TEXT("Asset Parent Folder"))
@@ -437,6 +507,7 @@ TSharedRef<SListView<TSharedPtr<FAssetData>>> SAssetActionsTab::ConstructAssetLi
 			.VAlignHeader(EVerticalAlignment::VAlign_Center)
 			.HAlignHeader(EHorizontalAlignment::HAlign_Center)
 			.SortMode(this, &SAssetActionsTab::GetSortModeForColumn, AssetActionsColumns::RefCount)
+			.SortPriority(this, &SAssetActionsTab::GetSortPriorityForColumn, AssetActionsColumns::RefCount)
 			.OnSort(this, &SAssetActionsTab::OnSortModeChanged)
 			[
 				ConstructTextForHeaderRow(TEXT("# of Refs"))
@@ -485,14 +556,28 @@ TSharedRef<SCheckBox> SAssetActionsTab::ConstructCheckBoxForHeaderRow()
 	HeaderCheckBox =
 		SNew(SCheckBox)
 		.Type(ESlateCheckBoxType::CheckBox)
+		.IsChecked(this, &SAssetActionsTab::GetHeaderCheckBoxState)
 		.OnCheckStateChanged(this, &SAssetActionsTab::OnHeaderCheckBoxStateChanged);
 
 	return HeaderCheckBox.ToSharedRef();
 }
 
+ECheckBoxState SAssetActionsTab::GetHeaderCheckBoxState() const
+/*
+	Checked when every displayed asset is checked, unchecked when none are, and undetermined otherwise
+*/
+{
+	if (NumCheckedDisplayedAssets == 0) return ECheckBoxState::Unchecked;
+
+	if (NumCheckedDisplayedAssets == DisplayedAssetsData.Num()) return ECheckBoxState::Checked;
+
+	return ECheckBoxState::Undetermined;
+}
+
 void SAssetActionsTab::OnHeaderCheckBoxStateChanged(ECheckBoxState CheckBoxState)
 /*
-	Select all or deselect all checkboxes in the rows depending on the state of the header checkbox
+	Select all or deselect all displayed assets depending on the state of the header checkbox.
+	This is a single pass over the checked rows; no row checkbox callback is fired.
 */
 {
 	switch (CheckBoxState)
@@ -500,30 +585,14 @@ void SAssetActionsTab::OnHeaderCheckBoxStateChanged(ECheckBoxState CheckBoxState
 	// deselect all
 	case ECheckBoxState::Unchecked:
 
-		if (CheckBoxesArray.Num() == 0) return;
-
-		for (TSharedRef<SCheckBox>& CheckBox : CheckBoxesArray)
-		{
-			if (CheckBox->IsChecked())
-			{
-				CheckBox->ToggleCheckedState();
-			}
-		}
+		SetDisplayedAssetsChecked(false);
 
 		break;
 
 	// select all
 	case ECheckBoxState::Checked:
 
-		if (CheckBoxesArray.Num() == 0) return;
-
-		for (TSharedRef<SCheckBox>& CheckBox : CheckBoxesArray)
-		{
-			if (!CheckBox->IsChecked())
-			{
-				CheckBox->ToggleCheckedState();
-			}
-		}
+		SetDisplayedAssetsChecked(true);
 
 		break;
 
@@ -541,14 +610,10 @@ void SAssetActionsTab::DefaultSorting()
 {
 	SortByColumn = AssetActionsColumns::Name;
 	SortMode = EColumnSortMode::Ascending;
+	SecondarySortByColumn = NAME_None;
+	SecondarySortMode = EColumnSortMode::None;
 
-	// A->Z primary sort = name; if equivalent, secondary sort = packagepath
-	DisplayedAssetsData.Sort(
-		[](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-		{
-			return (A->AssetName.Compare(B->AssetName) < 0 ||
-				((A->AssetName == B->AssetName) && (A->PackagePath.Compare(B->PackagePath) < 0)));
-		});
+	UpdateSorting();
 }
 
 EColumnSortMode::Type SAssetActionsTab::GetSortModeForColumn(const FName ColumnId) const
@@ -557,145 +622,414 @@ EColumnSortMode::Type SAssetActionsTab::GetSortModeForColumn(const FName ColumnI
 	If user selected column does not equal column passed in from header row, set sort mode to none
 */
 {
-	return SortByColumn == ColumnId ? SortMode : EColumnSortMode::None;
+	if (SortByColumn == ColumnId) return SortMode;
+
+	if (SecondarySortByColumn == ColumnId) return SecondarySortMode;
+
+	return EColumnSortMode::None;
 }
 
-void SAssetActionsTab::OnSortModeChanged(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+EColumnSortPriority::Type SAssetActionsTab::GetSortPriorityForColumn(const FName ColumnId) const
 /*
-	Set sort column and sort mode to user selected option. Then refresh widget which updates the applied sort order. 
+	Get the sort priority of the column; shift-clicking a header adds it as the secondary sort column
 */
 {
-	SortByColumn = ColumnId;
-	SortMode = InSortMode;
-	RefreshWidget();
+	return SecondarySortByColumn == ColumnId ? EColumnSortPriority::Secondary : EColumnSortPriority::Primary;
 }
 
-void SAssetActionsTab::UpdateSorting()
+void SAssetActionsTab::OnSortModeChanged(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
 /*
-	Sort DisplayedAssetData by comparing the data within the user selected column; called in RefreshWidget
-	Utilizes lambda fns to define sorting functions
+	Set primary or secondary sort column and sort mode to user selected option. Then re-sort the list view. 
 */
 {
+	if (SortPriority == EColumnSortPriority::Secondary)
+	{
+		// A column can't be both primary and secondary
+		if (ColumnId == SortByColumn) return;
 
-	// Sort by checked alphabetically and unchecked alphabetically
-	if (SortByColumn == AssetActionsColumns::Checkbox)
+		SecondarySortByColumn = ColumnId;
+		SecondarySortMode = InSortMode;
+	}
+	else
 	{
-		if (SortMode == EColumnSortMode::Ascending)
-		{
-			TArray<TSharedPtr<FAssetData>> SortedCheckedAssets = CheckedAssets;
-			TArray<TSharedPtr<FAssetData>> SortedUncheckedAssets = UncheckedAssets;
+		SortByColumn = ColumnId;
+		SortMode = InSortMode;
 
-			SortedCheckedAssets.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-			{ return A->AssetName.Compare(B->AssetName) < 0; }); // A->Z
+		// Selecting a new primary column clears the secondary column
+		SecondarySortByColumn = NAME_None;
+		SecondarySortMode = EColumnSortMode::None;
+	}
 
-			SortedUncheckedAssets.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-			{ return A->AssetName.Compare(B->AssetName) < 0; }); // A->Z
+	RefreshListView();
+}
 
-			DisplayedAssetsData.Empty();
-			DisplayedAssetsData.Append(CheckedAssets);
-			DisplayedAssetsData.Append(UncheckedAssets);
-		}
-		else
-		{
-			TArray<TSharedPtr<FAssetData>> SortedCheckedAssets = CheckedAssets;
-			TArray<TSharedPtr<FAssetData>> SortedUncheckedAssets = UncheckedAssets;
+void SAssetActionsTab::GetEffectiveSecondarySort(FName& OutColumnId, EColumnSortMode::Type& OutSortMode) const
+/*
+	Get the secondary sort column. When the user has not picked one, names are broken by parent folder 
+	(in the same direction) and the checkbox groups are sorted A->Z by name.
+*/
+{
+	OutColumnId = SecondarySortByColumn;
+	OutSortMode = SecondarySortMode;
 
-			SortedCheckedAssets.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{ return A->AssetName.Compare(B->AssetName) < 0; }); // A->Z
+	if (!OutColumnId.IsNone()) return;
 
-			SortedUncheckedAssets.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{ return A->AssetName.Compare(B->AssetName) < 0; }); // A->Z
+	if (SortByColumn == AssetActionsColumns::Name)
+	{
+		OutColumnId = AssetActionsColumns::Path;
+		OutSortMode = SortMode;
+	}
 
-			DisplayedAssetsData.Empty();
-			DisplayedAssetsData.Append(UncheckedAssets);
-			DisplayedAssetsData.Append(CheckedAssets);
-		}
+	else if (SortByColumn == AssetActionsColumns::Checkbox)
+	{
+		OutColumnId = AssetActionsColumns::Name;
+		OutSortMode = EColumnSortMode::Ascending;
 	}
+}
 
+int32 SAssetActionsTab::CompareAssetsForColumn(const FName& ColumnId, const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B) const
+/*
+	Compare two assets by a single column in ascending order; used for sorted insertion of changed assets.
+	The order matches the ranks in the sort keys so inserted rows land where a full sort would put them.
+*/
+{
+	if (ColumnId == AssetActionsColumns::Checkbox)
+	{
+		// Checked assets first
+		return (IsAssetChecked(A) ? 0 : 1) - (IsAssetChecked(B) ? 0 : 1);
+	}
 
-	// Sort alphabetically by asset name
-	if (SortByColumn == AssetActionsColumns::Name)
+	if (ColumnId == AssetActionsColumns::Class)
+	{
+		return A->AssetClassPath.GetAssetName().Compare(B->AssetClassPath.GetAssetName());
+	}
+
+	if (ColumnId == AssetActionsColumns::Name)
+	{
+		return A->AssetName.Compare(B->AssetName);
+	}
+
+	if (ColumnId == AssetActionsColumns::Path)
+	{
+		return A->PackagePath.Compare(B->PackagePath);
+	}
+
+	if (ColumnId == AssetActionsColumns::RefCount)
 	{
-		if (SortMode == EColumnSortMode::Ascending) 
+		FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+		return AssetActionsManager.GetAssetReferencersCount(A) - AssetActionsManager.GetAssetReferencersCount(B);
+	}
+
+	return 0;
+}
+
+SAssetActionsTab::FAssetSortPredicate SAssetActionsTab::GetSortPredicate() const
+/*
+	Return a predicate that compares two assets by the primary and then the secondary sort column.
+	Descending modes flip the result of the ascending comparison. While duplicate names are listed the sets are
+	compared first and only the primary column orders the assets within a set, as in UpdateSorting.
+*/
+{
+	FName SecondaryColumnId;
+	EColumnSortMode::Type SecondaryMode;
+	GetEffectiveSecondarySort(SecondaryColumnId, SecondaryMode);
+
+	const bool bGroupDuplicates = SelectedFilter == EAssetActionsFilter::DuplicateName;
+	const FAssetActionsManagerModule* AssetActionsManager = &LoadManagerModule();
+
+	return [this, AssetActionsManager, bGroupDuplicates, SecondaryColumnId, SecondaryMode](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
 		{
-			// A->Z primary sort = name; if equivalent, secondary sort = packagepath
-			DisplayedAssetsData.Sort(
-				[](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{ 
-					return (A->AssetName.Compare(B->AssetName) < 0 ||
-						((A->AssetName == B->AssetName) && (A->PackagePath.Compare(B->PackagePath) < 0)));
-				}); 
-		}
-		else 
-		{	
-			// Z->A primary sort = name; if equivalent, secondary sort = packagepath
-			DisplayedAssetsData.Sort(
-				[](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
+			if (bGroupDuplicates)
+			{
+				const int32 GroupResult = AssetActionsManager->CompareDuplicateNames(A->AssetName, B->AssetName);
+
+				if (GroupResult != 0) return GroupResult < 0;
+			}
+
+			int32 Result = CompareAssetsForColumn(SortByColumn, A, B);
+
+			if (SortMode == EColumnSortMode::Descending) { Result = -Result; }
+
+			if (Result == 0 && !bGroupDuplicates && !SecondaryColumnId.IsNone())
+			{
+				Result = CompareAssetsForColumn(SecondaryColumnId, A, B);
+
+				if (SecondaryMode == EColumnSortMode::Descending) { Result = -Result; }
+			}
+
+			return Result < 0;
+		};
+}
+
+void SAssetActionsTab::BuildSortKeys(bool bIncludeRefCounts)
+/*
+	Compute a compact key for every asset table row: the rank of its class, name and parent folder among all
+	distinct values (in FName compare order), and its referencer count. Keys are reused across sort changes
+	and patched for the rows an asset change touches.
+*/
+{
+	const bool bKeysCurrent = SortKeysGeneration == AssetDataGeneration;
+	const bool bRefCountsCurrent = RefCountKeysGeneration == AssetDataGeneration;
+
+	if (bKeysCurrent && (bRefCountsCurrent || !bIncludeRefCounts)) return;
+
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+
+	if (!bKeysCurrent)
+	{
+		// Rank every distinct value once so comparisons during the sort are integer compares
+		auto BuildRanks = [&AssetTable](auto GetColumn, FColumnRanks& OutRanks)
+			{
+				TSet<FName> DistinctValues;
+
+				for (TConstSetBitIterator<> It(AssetTable.GetLiveRows()); It; ++It)
 				{
-					return (B->AssetName.Compare(A->AssetName) < 0 ||
-						((B->AssetName == A->AssetName) && (B->PackagePath.Compare(A->PackagePath) < 0)));
-				});
+					DistinctValues.Add(GetColumn(It.GetIndex()));
+				}
+
+				OutRanks.SortedValues = DistinctValues.Array();
+				OutRanks.SortedValues.Sort([](const FName& A, const FName& B) { return A.Compare(B) < 0; });
+
+				OutRanks.Ranks.Empty(OutRanks.SortedValues.Num());
+
+				// Leave equal gaps between neighbouring ranks for values added by later asset changes
+				const uint32 RankSpacing = MAX_uint32 / static_cast<uint32>(OutRanks.SortedValues.Num() + 1);
+
+				for (int32 Index = 0; Index < OutRanks.SortedValues.Num(); ++Index)
+				{
+					OutRanks.Ranks.Add(OutRanks.SortedValues[Index], static_cast<uint32>(Index + 1) * RankSpacing);
+				}
+			};
+
+		BuildRanks([&AssetTable](int32 Row) { return AssetTable.GetAssetClassName(Row); }, ClassRanks);
+		BuildRanks([&AssetTable](int32 Row) { return AssetTable.GetAssetName(Row); }, NameRanks);
+		BuildRanks([&AssetTable](int32 Row) { return AssetTable.GetPackagePath(Row); }, PathRanks);
+
+		SortKeys.SetNum(AssetTable.GetMaxRows());
+
+		for (TConstSetBitIterator<> It(AssetTable.GetLiveRows()); It; ++It)
+		{
+			const int32 Row = It.GetIndex();
+
+			FAssetSortKey& SortKey = SortKeys[Row];
+			SortKey.ClassRank = ClassRanks.Ranks.FindChecked(AssetTable.GetAssetClassName(Row));
+			SortKey.NameRank = NameRanks.Ranks.FindChecked(AssetTable.GetAssetName(Row));
+			SortKey.PathRank = PathRanks.Ranks.FindChecked(AssetTable.GetPackagePath(Row));
 		}
+
+		SortKeysGeneration = AssetDataGeneration;
+		RefCountKeysGeneration = MAX_uint32;
 	}
 
-	// Sort alphabetically by asset class
-	if (SortByColumn == AssetActionsColumns::Class)
+	// Referencer counts are only gathered when sorting by count since the first pass queries the asset registry
+	if (bIncludeRefCounts && RefCountKeysGeneration != AssetDataGeneration)
 	{
-		if (SortMode == EColumnSortMode::Ascending)
+		FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+		AssetActionsManager.CacheAssetReferencersCounts(AssetTable.GetLiveRows());
+
+		for (TConstSetBitIterator<> It(AssetTable.GetLiveRows()); It; ++It)
 		{
-			DisplayedAssetsData.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{ return A->GetClass()->GetName().Compare(B->GetClass()->GetName()) < 0; }); // A->Z
+			SortKeys[It.GetIndex()].RefCount = static_cast<uint32>(AssetActionsManager.GetAssetReferencersCount(AssetTable.GetItem(It.GetIndex())));
 		}
-		else
+
+		RefCountKeysGeneration = AssetDataGeneration;
+	}
+}
+
+bool SAssetActionsTab::PatchSortKeys(const TArray<int32>& Rows)
+/*
+	Rank the class, name and parent folder of each row, adding values the ranks have not seen yet
+*/
+{
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+
+	if (SortKeys.Num() < AssetTable.GetMaxRows())
+	{
+		SortKeys.SetNum(AssetTable.GetMaxRows());
+	}
+
+	for (const int32 Row : Rows)
+	{
+		FAssetSortKey& SortKey = SortKeys[Row];
+
+		if (!FindOrAddRank(ClassRanks, AssetTable.GetAssetClassName(Row), SortKey.ClassRank) ||
+			!FindOrAddRank(NameRanks, AssetTable.GetAssetName(Row), SortKey.NameRank) ||
+			!FindOrAddRank(PathRanks, AssetTable.GetPackagePath(Row), SortKey.PathRank))
 		{
-			DisplayedAssetsData.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{ return B->GetClass()->GetName().Compare(A->GetClass()->GetName()) < 0; }); // Z->A
+			return false;
 		}
 	}
 
-	// Sort alphabetically by asset parent folder path
-	if (SortByColumn == AssetActionsColumns::Path)
+	return true;
+}
+
+bool SAssetActionsTab::FindOrAddRank(FColumnRanks& ColumnRanks, const FName& Value, uint32& OutRank)
+/*
+	Binary search for the neighbours of a new value in compare order; fails once they hold adjacent ranks
+*/
+{
+	if (const uint32* FoundRank = ColumnRanks.Ranks.Find(Value))
+	{
+		OutRank = *FoundRank;
+		return true;
+	}
+
+	const int32 InsertIndex = Algo::LowerBound(ColumnRanks.SortedValues, Value, [](const FName& A, const FName& B) { return A.Compare(B) < 0; });
+
+	const uint32 LowerRank = InsertIndex > 0 ? ColumnRanks.Ranks.FindChecked(ColumnRanks.SortedValues[InsertIndex - 1]) : 0;
+	const uint32 UpperRank = InsertIndex < ColumnRanks.SortedValues.Num() ? ColumnRanks.Ranks.FindChecked(ColumnRanks.SortedValues[InsertIndex]) : MAX_uint32;
+
+	if (UpperRank - LowerRank < 2) return false;
+
+	OutRank = LowerRank + (UpperRank - LowerRank) / 2;
+
+	ColumnRanks.SortedValues.Insert(Value, InsertIndex);
+	ColumnRanks.Ranks.Add(Value, OutRank);
+
+	return true;
+}
+
+uint32 SAssetActionsTab::GetColumnRank(const FName& ColumnId, const FAssetSortKey& SortKey, bool bChecked)
+/*
+	Project a sort key onto a single column
+*/
+{
+	if (ColumnId == AssetActionsColumns::Checkbox) return bChecked ? 0 : 1;
+	if (ColumnId == AssetActionsColumns::Class) return SortKey.ClassRank;
+	if (ColumnId == AssetActionsColumns::Name) return SortKey.NameRank;
+	if (ColumnId == AssetActionsColumns::Path) return SortKey.PathRank;
+	if (ColumnId == AssetActionsColumns::RefCount) return SortKey.RefCount;
+
+	return 0;
+}
+
+void SAssetActionsTab::BuildDuplicateGroupRanks(const TArray<int32>& DisplayedRows, TArray<uint32>& OutGroupRanks)
+/*
+	Rank every duplicate name set by name so the sets appear in the same order as a name sort. Sets that only 
+	differ in casing share a name rank and are ordered as the sort predicate orders them. Only the displayed
+	rows are grouped; they are the rows that passed the duplicate name filter, so the filter never runs here.
+*/
+{
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+	const FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+
+	TBitArray<> RowsToGroup(false, AssetTable.GetMaxRows());
+
+	for (const int32 Row : DisplayedRows)
 	{
-		if (SortMode == EColumnSortMode::Ascending)
+		RowsToGroup[Row] = true;
+	}
+
+	TArray<TArray<int32>> DuplicateGroups = AssetActionsManager.GroupDuplicateNames(RowsToGroup);
+
+	DuplicateGroups.Sort([this, &AssetTable, &AssetActionsManager](const TArray<int32>& A, const TArray<int32>& B)
 		{
-			DisplayedAssetsData.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{ return A->PackagePath.Compare(B->PackagePath) < 0; }); // A->Z
-		}
-		else
+			if (SortKeys[A[0]].NameRank != SortKeys[B[0]].NameRank)
+			{
+				return SortKeys[A[0]].NameRank < SortKeys[B[0]].NameRank;
+			}
+
+			return AssetActionsManager.CompareDuplicateNames(AssetTable.GetAssetName(A[0]), AssetTable.GetAssetName(B[0])) < 0;
+		});
+
+	OutGroupRanks.Init(0, AssetTable.GetMaxRows());
+
+	for (int32 GroupIndex = 0; GroupIndex < DuplicateGroups.Num(); ++GroupIndex)
+	{
+		for (const int32 Row : DuplicateGroups[GroupIndex])
 		{
-			DisplayedAssetsData.Sort([](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{ return B->PackagePath.Compare(A->PackagePath) < 0; }); // Z->A
+			OutGroupRanks[Row] = static_cast<uint32>(GroupIndex);
 		}
 	}
+}
+
+void SAssetActionsTab::UpdateSorting()
+/*
+	Sort DisplayedAssetData with a decorate-sort: each displayed asset is reduced to one 64 bit value holding 
+	its primary rank in the high half and its secondary rank in the low half (inverted for descending). 
+	The index array is then sorted with a plain integer compare and the assets are reordered once, 
+	recording the new index of every displayed row.
+*/
+{
+	// A load sorts once every row is listed, so a sort column picked meanwhile is applied when it finishes
+	if (bTimeSlicedLoadActive) return;
+
+	ASSET_ACTIONS_SCOPE(UpdateSorting);
+
+	FName SecondaryColumnId;
+	EColumnSortMode::Type SecondaryMode;
+	GetEffectiveSecondarySort(SecondaryColumnId, SecondaryMode);
+
+	const bool bSortByRefCount = SortByColumn == AssetActionsColumns::RefCount || SecondaryColumnId == AssetActionsColumns::RefCount;
+	const bool bSortByCheckbox = SortByColumn == AssetActionsColumns::Checkbox || SecondaryColumnId == AssetActionsColumns::Checkbox;
+
+	BuildSortKeys(bSortByRefCount);
+
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+
+	const bool bPrimaryDescending = SortMode == EColumnSortMode::Descending;
+	const bool bSecondaryDescending = SecondaryMode == EColumnSortMode::Descending;
+
+	TArray<int32> DisplayedRows;
+	DisplayedRows.Reserve(DisplayedAssetsData.Num());
+
+	for (const TSharedPtr<FAssetData>& DisplayedAsset : DisplayedAssetsData)
+	{
+		DisplayedRows.Add(AssetTable.FindRow(DisplayedAsset));
+	}
+
+	// Keep each set of duplicate names together; the selected column orders the assets within a set
+	const bool bGroupDuplicates = SelectedFilter == EAssetActionsFilter::DuplicateName;
+	TArray<uint32> DuplicateGroupRanks;
 
-	// Sort by asset reference count
-	if (SortByColumn == AssetActionsColumns::RefCount)
+	if (bGroupDuplicates)
 	{
-		FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+		BuildDuplicateGroupRanks(DisplayedRows, DuplicateGroupRanks);
+	}
 
-		if (SortMode == EColumnSortMode::Ascending)
-		{
-			DisplayedAssetsData.Sort(
-				[&](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{
-					int32 CountA = AssetActionsManager.GetAssetReferencersCount(A);
-					int32 CountB = AssetActionsManager.GetAssetReferencersCount(B);
+	// Decorate: packed key per displayed asset plus its current index
+	TArray<TPair<uint64, int32>> DecoratedAssets;
+	DecoratedAssets.Reserve(DisplayedAssetsData.Num());
+
+	for (int32 Index = 0; Index < DisplayedAssetsData.Num(); ++Index)
+	{
+		const int32 Row = DisplayedRows[Index];
+		const FAssetSortKey& SortKey = SortKeys[Row];
+		const bool bChecked = bSortByCheckbox && CheckedRows.IsValidIndex(Row) && CheckedRows[Row];
 
-					return CountA < CountB; // least->most
-				});
+		uint32 PrimaryRank = GetColumnRank(SortByColumn, SortKey, bChecked);
+		uint32 SecondaryRank = SecondaryColumnId.IsNone() ? 0 : GetColumnRank(SecondaryColumnId, SortKey, bChecked);
+
+		if (bPrimaryDescending) { PrimaryRank = MAX_uint32 - PrimaryRank; }
+		if (bSecondaryDescending) { SecondaryRank = MAX_uint32 - SecondaryRank; }
+
+		if (bGroupDuplicates)
+		{
+			SecondaryRank = PrimaryRank;
+			PrimaryRank = DuplicateGroupRanks[Row];
 		}
-		else
+
+		DecoratedAssets.Emplace((static_cast<uint64>(PrimaryRank) << 32) | SecondaryRank, Index);
+	}
+
+	// Sort: ties keep their previous order
+	Algo::Sort(DecoratedAssets, [](const TPair<uint64, int32>& A, const TPair<uint64, int32>& B)
 		{
-			DisplayedAssetsData.Sort(
-				[&](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B)
-				{
-					int32 CountA = AssetActionsManager.GetAssetReferencersCount(A);
-					int32 CountB = AssetActionsManager.GetAssetReferencersCount(B);
+			return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
+		});
 
-					return CountB < CountA; // most->least
-				});
-		}
+	// Undecorate
+	TArray<TSharedPtr<FAssetData>> SortedAssetsData;
+	SortedAssetsData.Reserve(DisplayedAssetsData.Num());
+
+	DisplayedIndexByRow.Init(INDEX_NONE, AssetTable.GetMaxRows());
+
+	for (const TPair<uint64, int32>& DecoratedAsset : DecoratedAssets)
+	{
+		DisplayedIndexByRow[DisplayedRows[DecoratedAsset.Value]] = SortedAssetsData.Add(MoveTemp(DisplayedAssetsData[DecoratedAsset.Value]));
 	}
+
+	DisplayedAssetsData = MoveTemp(SortedAssetsData);
 }
 
 #pragma endregion
@@ -707,17 +1041,27 @@ TSharedRef<ITableRow> SAssetActionsTab::OnGenerateRowForListView(TSharedPtr<FAss
 	Generate a STableRow for every asset and define child layout and widgets for each row
 */
 {
+	ASSET_ACTIONS_SCOPE(OnGenerateRowForListView);
+
 	// check if AssetData is valid
 	if (!AssetDataToDisplay.IsValid()) return SNew(STableRow<TSharedPtr<FAssetData>>, OwnerTable);
 
-	// Get AssetData values
-	const FString AssetName = AssetDataToDisplay->AssetName.ToString();
-	const FString AssetClass = AssetDataToDisplay->GetClass()->GetName();
-	const FString AssetParentFolder = AssetDataToDisplay->PackagePath.ToString();
+	ASSET_ACTIONS_COUNT(RowsGenerated, 1);
+
+	// Bind AssetData values so a row reused after a rename or reference change stays current
+	TAttribute<FText> AssetName = TAttribute<FText>::CreateLambda([AssetDataToDisplay]()
+		{ return FText::FromName(AssetDataToDisplay->AssetName); });
+
+	TAttribute<FText> AssetClass = TAttribute<FText>::CreateLambda([AssetDataToDisplay]()
+		{ return FText::FromName(AssetDataToDisplay->AssetClassPath.GetAssetName()); });
+
+	TAttribute<FText> AssetParentFolder = TAttribute<FText>::CreateLambda([AssetDataToDisplay]()
+		{ return FText::FromName(AssetDataToDisplay->PackagePath); });
 	
-	// Load manager module and call referencer count fn
-	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
-	const FString AssetRefCount = FString::FromInt(AssetActionsManager.GetAssetReferencersCount(AssetDataToDisplay));
+	// Referencer count is read from the manager's cache
+	FAssetActionsManagerModule* AssetActionsManager = &LoadManagerModule();
+	TAttribute<FText> AssetRefCount = TAttribute<FText>::CreateLambda([AssetActionsManager, AssetDataToDisplay]()
+		{ return FText::AsNumber(AssetActionsManager->GetAssetReferencersCount(AssetDataToDisplay)); });
 
 	// return a ref to a table row to the OnGenerateRow fn
 	TSharedRef<STableRow<TSharedPtr<FAssetData>>> RowWidgetForListView =
@@ -789,131 +1133,59 @@ TSharedRef<ITableRow> SAssetActionsTab::OnGenerateRowForListView(TSharedPtr<FAss
 
 TSharedRef<SCheckBox> SAssetActionsTab::ConstructCheckBoxes(const TSharedPtr<FAssetData>& AssetDataToDisplay)
 /*
-	Generate a SCheckBox for each row, add to CheckBoxArray, and set checkbox to previously checked state
+	Generate a SCheckBox for each row. The checked state is bound to the asset's checked row, so a reused 
+	or regenerated row always shows the current state without being tracked by the widget.
 */
 {
 	TSharedRef<SCheckBox> ConstructedCheckBox =
 		SNew(SCheckBox)
 		.Type(ESlateCheckBoxType::CheckBox)
+		.IsChecked(this, &SAssetActionsTab::GetCheckBoxState, AssetDataToDisplay)
 		.OnCheckStateChanged(this, &SAssetActionsTab::OnCheckBoxStateChanged, AssetDataToDisplay);
 
-	CheckBoxesArray.Add(ConstructedCheckBox);
+	return ConstructedCheckBox;
+}
+
+void SAssetActionsTab::OnCheckBoxStateChanged(ECheckBoxState CheckBoxState, TSharedPtr<FAssetData> ClickedAssetData)
+/* 
+	Set the checked bit of the clicked asset's row and keep the header count in step.
+	Shift-clicking applies the new state to every displayed asset between the last clicked row and this one.
+*/
+{
+	if (CheckBoxState == ECheckBoxState::Undetermined) return;
 
-	// set checkboxes to previous state
-	TMultiMap<FString, FString> CheckedAssetMap = GetCheckBoxAssetMap(CheckedAssets);
-	TMultiMap<FString, FString> UncheckedAssetMap = GetCheckBoxAssetMap(UncheckedAssets);
-	FString AssetName = AssetDataToDisplay->AssetName.ToString();
-	FString AssetPath = AssetDataToDisplay->GetObjectPathString();
+	const bool bChecked = CheckBoxState == ECheckBoxState::Checked;
 
-	if (CheckedAssetMap.FindPair(AssetName, AssetPath) != nullptr)
+	if (FSlateApplication::Get().GetModifierKeys().IsShiftDown() && SelectionAnchor.IsValid())
 	{
-		if (!ConstructedCheckBox->IsChecked())
+		const int32 AnchorIndex = DisplayedAssetsData.Find(SelectionAnchor);
+		const int32 ClickedIndex = DisplayedAssetsData.Find(ClickedAssetData);
+
+		if (AnchorIndex != INDEX_NONE && ClickedIndex != INDEX_NONE)
 		{
-			ConstructedCheckBox->SetIsChecked(ECheckBoxState::Checked);
+			SetDisplayedRangeChecked(AnchorIndex, ClickedIndex, bChecked);
+			SelectionAnchor = ClickedAssetData;
+			return;
 		}
 	}
 
-	if (UncheckedAssetMap.FindPair(AssetName, AssetPath) != nullptr)
+	SelectionAnchor = ClickedAssetData;
+
+	// The clicked row is always displayed, so the displayed count changes with it
+	if (SetAssetChecked(ClickedAssetData, bChecked))
 	{
-		if (ConstructedCheckBox->IsChecked())
-		{
-			ConstructedCheckBox->SetIsChecked(ECheckBoxState::Unchecked);
-		}
+		NumCheckedDisplayedAssets += bChecked ? 1 : -1;
 	}
-
-	return ConstructedCheckBox;
 }
 
-void SAssetActionsTab::OnCheckBoxStateChanged(ECheckBoxState CheckBoxState, TSharedPtr<FAssetData> ClickedAssetData)
-/* 
-	Add assets to checked and unchecked arrays and set header state based on row checkbox state
-*/
-{
-	// Finding checkbox state based on both asset name and asset path
-	TMultiMap<FString, FString> CheckedAssetMap = GetCheckBoxAssetMap(CheckedAssets);
-	TMultiMap<FString, FString> UncheckedAssetMap = GetCheckBoxAssetMap(UncheckedAssets);
-	FString AssetName = ClickedAssetData->AssetName.ToString();
-	FString AssetPath = ClickedAssetData->GetObjectPathString();
-
-	switch (CheckBoxState)
-	{
-	case ECheckBoxState::Unchecked:
-
-		// if found in checked assets, remove asset
-		if (CheckedAssetMap.FindPair(AssetName, AssetPath) != nullptr) 
-		{
-			TArray<TSharedPtr<FAssetData>> AssetsToRemove;
-
-			for (TSharedPtr<FAssetData> Asset : CheckedAssets)
-			{
-				if (Asset->AssetName == AssetName && Asset->GetObjectPathString() == AssetPath)
-				{
-					AssetsToRemove.AddUnique(Asset);
-				}
-			}
-
-			for (TSharedPtr<FAssetData> AssetToRemove : AssetsToRemove)
-			{
-				CheckedAssets.Remove(AssetToRemove);
-			}
-		}
-
-		// if not found in unchecked assets, add asset
-		if (UncheckedAssetMap.FindPair(AssetName, AssetPath) == nullptr)
-		{
-			UncheckedAssets.AddUnique(ClickedAssetData);
-		}
-
-		TrackCheckBoxStateForHeader();
-
-		break;
-
-	case ECheckBoxState::Checked:
-
-		// if found in unchecked assets, remove asset
-		if (UncheckedAssetMap.FindPair(AssetName, AssetPath) != nullptr)
-		{
-			TArray<TSharedPtr<FAssetData>> AssetsToRemove;
-
-			for (TSharedPtr<FAssetData> Asset : UncheckedAssets)
-			{
-				if (Asset->AssetName == AssetName && Asset->GetObjectPathString() == AssetPath)
-				{
-					AssetsToRemove.AddUnique(Asset);
-				}
-			}
-
-			for (TSharedPtr<FAssetData> Asset : AssetsToRemove)
-			{
-				UncheckedAssets.Remove(Asset);
-			}
-		}
-
-		// if not found in checked assets, add asset
-		if (CheckedAssetMap.FindPair(AssetName, AssetPath) == nullptr)
-		{
-			CheckedAssets.AddUnique(ClickedAssetData);
-		}
-
-		TrackCheckBoxStateForHeader();
-
-		break;
-
-	case ECheckBoxState::Undetermined:
-		break;
-	default:
-		break;
-	}
-}
-
-TSharedRef<STextBlock> SAssetActionsTab::ConstructTextForRow(const FString& RowText)
+TSharedRef<STextBlock> SAssetActionsTab::ConstructTextForRow(const TAttribute<FText>& RowText)
 /*
 	Common function to construct any textblocks for rows in the list view
 */
 {
 	TSharedRef<STextBlock> ConstructedTextBlock =
 		SNew(STextBlock)
-		.Text(FText::FromString(RowText))
+		.Text(RowText)
 		.Font(SharedTextFont)
 		.ColorAndOpacity(FColor::White)
 		.WrappingPolicy(ETextWrappingPolicy::AllowPerCharacterWrapping)
@@ -931,7 +1203,7 @@ TSharedRef<SButton> SAssetActionsTab::ConstructRenameButtonForRow(const TSharedP
 		SNew(SButton)
 		.OnClicked(this, &SAssetActionsTab::OnRenameButtonClicked, AssetDataToDisplay);
 
-	ConstructedRenameButton->SetContent(ConstructTextForRow(TEXT("Rename")));
+	ConstructedRenameButton->SetContent(ConstructTextForRow(FText::FromString(TEXT("Rename"))));
 
 	return ConstructedRenameButton;
 }
@@ -972,7 +1244,8 @@ FReply SAssetActionsTab::OnRenameButtonClicked(TSharedPtr<FAssetData> ClickedAss
 
 void SAssetActionsTab::RenameAsset(const FString& NewName, const TSharedPtr<FAssetData>& AssetToRename)
 /* 
-	Call manager fn to rename clicked asset and if asset is successfully renamed, refresh widget
+	Call manager fn to rename clicked asset. The renamed row is updated in place through the asset changes 
+	reported by the manager, so the rest of the list is left untouched.
 */
 {
 	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
@@ -983,12 +1256,8 @@ void SAssetActionsTab::RenameAsset(const FString& NewName, const TSharedPtr<FAss
 
 	if (bAssetRenamed)
 	{
-		CheckedAssets.Remove(AssetToRename);
-		UncheckedAssets.AddUnique(AssetToRename);
-		RefreshWidget();
+		AssetActionsManager.FixUpRedirectors();
 	}
-
-	TrackCheckBoxStateForHeader();
 }
 
 #pragma endregion
@@ -1056,75 +1325,104 @@ void SAssetActionsTab::AssignButtonClickFns(const FString& ButtonName)
 
 FReply SAssetActionsTab::OnAddPrefixButtonClicked()
 /*
-	Attempts to add prefixes to all assets in CheckedAssets and if successful, refreshes widget
+	Starts a job that adds prefixes to all checked assets a chunk at a time.
+	Renamed rows are updated through the asset changes reported by the manager.
 */
 {
-	if (CheckedAssets.Num() == 0)
+	if (NumCheckedRows == 0)
 	{
 		DebugHelper::MessageDialogBox(EAppMsgType::Ok, TEXT("No assets selected."));
 		return FReply::Handled();
 	}
 
-	// Call add prefix fn from manager module passing in the checked data
-	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
-	bool bPrefixesAdded = AssetActionsManager.AddPrefixesToAssetsInList(CheckedAssets);
-
-	if (bPrefixesAdded)
-	{
-		CheckedAssets.Empty();
-		RefreshWidget();
-	}
-
-	TrackCheckBoxStateForHeader();
+	// Call add prefix fn from manager module for each chunk of the checked data
+	StartBulkActionJob(MakeShared<FAssetActionsJob>(TEXT("Adding prefixes"), GetCheckedAssets(),
+		[this](const TArray<TSharedPtr<FAssetData>>& Chunk, TArray<TSharedPtr<FAssetData>>&)
+		{
+			return LoadManagerModule().AddPrefixesToAssetsInList(Chunk);
+		}), true);
 
 	return FReply::Handled();
 }
 
 FReply SAssetActionsTab::OnDeleteSelectedButtonClicked()
 /*
-	Attempts to delete all assets in CheckedAssets and if successful, refreshes widget
+	Chunks are deleted without confirmation, which silently skips referenced assets. So chunking is only used when
+	nothing outside the selection references it, with referencers ordered before the assets they reference.
+	Otherwise the selection goes through the engine's delete dialog in one pass, which warns about references
+	and offers a force delete. Deleted rows are removed through the asset changes reported by the manager.
 */
 {
-	if (CheckedAssets.Num() == 0)
+	if (NumCheckedRows == 0)
 	{
 		DebugHelper::MessageDialogBox(EAppMsgType::Ok, TEXT("No assets selected."));
 		return FReply::Handled();
 	}
-	
-	// Convert array of ptr to array of FAssetData for delete fn
-	TArray<FAssetData> AssetsToDelete;
-		
-	for (const TSharedPtr<FAssetData>& AssetData : CheckedAssets)
-	{
-		AssetsToDelete.Add(*AssetData.Get());
-	}
 
-	// Call delete fn from manager module passing in the checked data
 	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
-	bool bAssetDeleted = AssetActionsManager.DeleteAssetsInList(AssetsToDelete);
+	TArray<TSharedPtr<FAssetData>> AssetsToDelete = GetCheckedAssets();
 
-	// Remove from list view if asset was deleted and refresh widget
-	if (bAssetDeleted)
+	if (!AssetActionsManager.OrderAssetsForChunkedDeletion(AssetsToDelete))
 	{
-		for (const TSharedPtr<FAssetData>& DeletedAsset : CheckedAssets)
+		TArray<FAssetData> AssetsToValidate;
+		AssetsToValidate.Reserve(AssetsToDelete.Num());
+
+		for (const TSharedPtr<FAssetData>& AssetData : AssetsToDelete)
 		{
-			EnsureAssetDeletionFromLists(DeletedAsset);
+			AssetsToValidate.Add(*AssetData.Get());
 		}
 
-		CheckedAssets.Empty();
-		RefreshWidget();
-		TrackCheckBoxStateForHeader();
+		// Assets the dialog did not delete stay checked
+		TArray<FAssetData> SkippedAssets;
+		AssetActionsManager.DeleteAssetsInList(AssetsToValidate, true, &SkippedAssets);
+
+		DebugHelper::PrintLog(FString::Printf(TEXT("Deleting assets finished with %d of %d assets deleted"), 
+			AssetsToValidate.Num() - SkippedAssets.Num(), AssetsToValidate.Num()));
+
+		return FReply::Handled();
 	}
 
+	const EAppReturnType::Type ConfirmResult = DebugHelper::MessageDialogBox(EAppMsgType::YesNo, 
+		FString::Printf(TEXT("Delete %d selected assets?"), NumCheckedRows), TEXT("Delete Selected"));
+
+	if (ConfirmResult != EAppReturnType::Yes) { return FReply::Handled(); }
+
+	// Call delete fn from manager module for each chunk of the ordered checked data
+	StartBulkActionJob(MakeShared<FAssetActionsJob>(TEXT("Deleting assets"), MoveTemp(AssetsToDelete),
+		[this](const TArray<TSharedPtr<FAssetData>>& Chunk, TArray<TSharedPtr<FAssetData>>& OutSkippedAssets)
+		{
+			// Convert array of ptr to array of FAssetData for delete fn
+			TArray<FAssetData> ChunkAssets;
+
+			for (const TSharedPtr<FAssetData>& AssetData : Chunk)
+			{
+				ChunkAssets.Add(*AssetData.Get());
+			}
+
+			TArray<FAssetData> SkippedAssets;
+			const bool bDeletedAssets = LoadManagerModule().DeleteAssetsInList(ChunkAssets, false, &SkippedAssets);
+
+			for (const FAssetData& SkippedAsset : SkippedAssets)
+			{
+				OutSkippedAssets.Add(Chunk[ChunkAssets.IndexOfByPredicate([&SkippedAsset](const FAssetData& ChunkAsset)
+					{
+						return ChunkAsset.GetSoftObjectPath() == SkippedAsset.GetSoftObjectPath();
+					})]);
+			}
+
+			return bDeletedAssets;
+		}), false);
+
 	return FReply::Handled();
 }
 
 FReply SAssetActionsTab::OnDuplicateSelectedButtonClicked()
 /*
-	Attempts to duplicate all assets in CheckedAssets and if successful, refreshes widget
+	Starts a job that duplicates all checked assets a chunk at a time.
+	New rows are added through the asset changes reported by the manager.
 */
 {
-	if (CheckedAssets.Num() == 0)
+	if (NumCheckedRows == 0)
 	{
 		DebugHelper::MessageDialogBox(EAppMsgType::Ok, TEXT("No assets selected."));
 		return FReply::Handled();
@@ -1133,16 +1431,15 @@ FReply SAssetActionsTab::OnDuplicateSelectedButtonClicked()
 	// Spawn modal dialog to get user input
 	int32 NumOfDuplicates = GetUserNumberForDuplicates();
 
-	// Call duplicate fn from manager module passing in the user input and checked data
-	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
-	bool bAssetsDuplicated = AssetActionsManager.DuplicateAssetsInList(NumOfDuplicates, CheckedAssets);
+	// Cancelled, so the selection is kept
+	if (NumOfDuplicates <= 0) { return FReply::Handled(); }
 
-	if (bAssetsDuplicated)
-	{
-		CheckedAssets.Empty();
-		RefreshWidget();
-		TrackCheckBoxStateForHeader();
-	}
+	// Call duplicate fn from manager module for each chunk of the checked data
+	StartBulkActionJob(MakeShared<FAssetActionsJob>(TEXT("Duplicating assets"), GetCheckedAssets(),
+		[this, NumOfDuplicates](const TArray<TSharedPtr<FAssetData>>& Chunk, TArray<TSharedPtr<FAssetData>>&)
+		{
+			return LoadManagerModule().DuplicateAssetsInList(NumOfDuplicates, Chunk);
+		}), false);
 
 	return FReply::Handled();
 }
@@ -1226,10 +1523,11 @@ int32 SAssetActionsTab::GetUserNumberForDuplicates()
 
 FReply SAssetActionsTab::OnReplaceStringButtonClicked()
 /*
-	Attempts to replace string in all asset names in CheckedAssets and if successful, refreshes widget
+	Starts a job that replaces a string in all checked asset names a chunk at a time.
+	Renamed rows are updated through the asset changes reported by the manager.
 */
 {
-	if (CheckedAssets.Num() == 0)
+	if (NumCheckedRows == 0)
 	{
 		DebugHelper::MessageDialogBox(EAppMsgType::Ok, TEXT("No assets selected."));
 		return FReply::Handled();
@@ -1264,226 +1562,1114 @@ FReply SAssetActionsTab::OnReplaceStringButtonClicked()
 		return FReply::Handled();
 	}
 
-	// Call replace string fn from manager module passing in the user input and checked data
-	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
-	bool bStringReplaced = AssetActionsManager.ReplaceString(OldString, NewString, CheckedAssets);
-
-	if (bStringReplaced)
-	{
-		CheckedAssets.Empty();
-		RefreshWidget();
-		TrackCheckBoxStateForHeader();
-	}
+	// Call replace string fn from manager module for each chunk of the checked data
+	StartBulkActionJob(MakeShared<FAssetActionsJob>(TEXT("Replacing strings"), GetCheckedAssets(),
+		[this, OldString, NewString](const TArray<TSharedPtr<FAssetData>>& Chunk, TArray<TSharedPtr<FAssetData>>&)
+		{
+			return LoadManagerModule().ReplaceString(OldString, NewString, Chunk);
+		}), true);
 
 	return FReply::Handled();
 }
 
 #pragma endregion
 
-#pragma region HelpfulInfoSlot
+#pragma region BulkActionJob
 
-TSharedRef<SRichTextBlock> SAssetActionsTab::ConstructTextForAssetCount()
+void SAssetActionsTab::StartBulkActionJob(const TSharedRef<FAssetActionsJob>& Job, bool bFixUpRedirectors)
 /*
-	Construct a textblock that can be dynamically refreshed that keeps track of displayed asset count
+	Keep the job and register an active timer that runs it; the buttons stay disabled until it finishes
 */
 {
-	const FTextBlockStyle TextBlockStyle = 
-		FTextBlockStyle().SetFont(SharedTextFont).SetColorAndOpacity(FColor::White);
+	if (ActiveJob.IsValid()) { return; }
 
-	ConstructedAssetCountTextBlock =
-		SNew(SRichTextBlock);
-		
-	ConstructedAssetCountTextBlock->SetText(FText::FromString(AssetCountMsg));
-	ConstructedAssetCountTextBlock->SetTextStyle(TextBlockStyle);
+	ActiveJob = Job;
+	bFixUpRedirectorsAfterJob = bFixUpRedirectors;
 
-	return ConstructedAssetCountTextBlock.ToSharedRef();
+	RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SAssetActionsTab::TickBulkActionJob));
 }
 
-TSharedRef<STextBlock> SAssetActionsTab::ConstructTextForSelectedFolderPath()
+EActiveTimerReturnType SAssetActionsTab::TickBulkActionJob(double InCurrentTime, float InDeltaTime)
 {
-	FString SelectedFolderPathsText;
-	FString SelectedFolderDisplayedText;
-
-	// when only one folder is selected, set text equal to only element
-	if (SelectedFoldersPaths.Num() == 1)
-	{
-		SelectedFolderPathsText = SelectedFoldersPaths[0];
-		SelectedFolderDisplayedText = SelectedFolderPathsText;
-	}
+	if (!ActiveJob.IsValid()) { return EActiveTimerReturnType::Stop; }
 
-	// else append each folder path with a + separator
-	else if (SelectedFoldersPaths.Num() > 1)
+	if (ActiveJob->ProcessNextChunk())
 	{
-		for (int i = 0; i < SelectedFoldersPaths.Num(); ++i)
-		{
-			// if last element in list, don't add + seperator
-			if (i == SelectedFoldersPaths.Num() - 1)
-			{
-				SelectedFolderPathsText.Append(SelectedFoldersPaths[i]);
-			}
-
-			else
-			{
-				SelectedFolderPathsText.Append(SelectedFoldersPaths[i] + TEXT(" + "));
-			}
-		}
-
-		if (SelectedFoldersPaths.Num() > 4)
-		{
-			SelectedFolderDisplayedText = 
-				TEXT("Too many folders selected to display. Refer to Content Browser");
-		}
-
-		SelectedFolderDisplayedText = SelectedFolderPathsText;
+		return EActiveTimerReturnType::Continue;
 	}
 
-	TSharedRef<STextBlock> ConstructedTextBlock =
-		SNew(STextBlock)
-		.Text(FText::FromString(TEXT("Selected folder path: ") + SelectedFolderDisplayedText))
-		.Font(SharedTextFont)
-		.ColorAndOpacity(FColor::White)
-		.AutoWrapText(true);
+	FinishBulkActionJob();
 
-	return ConstructedTextBlock;
+	return EActiveTimerReturnType::Stop;
 }
 
-#pragma endregion
-
-#pragma region HelperFunctions
-
-void SAssetActionsTab::RefreshWidget()
+void SAssetActionsTab::FinishBulkActionJob()
 /*
-	Refresh asset data and source items to ensure AssetListView and AssetCount is always up to date
+	Only assets the action changed are unchecked, so after a cancel or a failed chunk the remaining selection is 
+	exactly the assets the action did not change and it can be started again on them
 */
 {
-	// Call fix up redirectors fn from manager module
-	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
-	AssetActionsManager.FixUpRedirectors();
-
-	// Refresh source items to pick up changes
-	AllAssetsDataFromManager = AssetActionsManager.GetAllAssetDataUnderSelectedFolder();
+	bool bCheckedRowsChanged = false;
 
-	FilterAssetData();
-	
-	if (ComboBoxDisplayedText->GetText().ToString() == ListAll)
+	for (const TSharedPtr<FAssetData>& ChangedAsset : ActiveJob->GetChangedAssets())
 	{
-		DisplayedAssetsData = AllAssetsDataFromManager;
+		bCheckedRowsChanged |= SetAssetChecked(ChangedAsset, false);
 	}
 
-	else if (ComboBoxDisplayedText->GetText().ToString() == ListUnused)
+	if (bCheckedRowsChanged)
 	{
-		DisplayedAssetsData = UnusedAssetsData;
+		OnCheckedRowsChanged();
 	}
 
-	else if (ComboBoxDisplayedText->GetText().ToString() == ListDuplicate)
+	if (bFixUpRedirectorsAfterJob && ActiveJob->HasChangedAssets())
 	{
-		DisplayedAssetsData = DuplicatedNameAssetsData;
+		LoadManagerModule().FixUpRedirectors();
 	}
 
-	else if (ComboBoxDisplayedText->GetText().ToString() == ListNoPrefix)
+	DebugHelper::PrintLog(ActiveJob->GetSummary());
+
+	for (const TSharedPtr<FAssetData>& SkippedAsset : ActiveJob->GetSkippedAssets())
 	{
-		DisplayedAssetsData = NoPrefixAssetsData;
+		DebugHelper::PrintLog(FString::Printf(TEXT("Skipped %s"), *SkippedAsset->GetObjectPathString()));
 	}
 
-	// Refresh sorting
-	UpdateSorting();
-
-	// Refresh Asset List View
-	if (ConstructedAssetListView.IsValid())
+	if (!ActiveJob->GetSkippedAssets().IsEmpty())
 	{
-		ConstructedAssetListView->RebuildList();
+		DebugHelper::MessageDialogBox(EAppMsgType::Ok, FString::Printf(TEXT("%d assets were left unchanged and stay selected. See the output log for the list."), 
+			ActiveJob->GetSkippedAssets().Num()));
 	}
 
-	// Refresh Asset Count Text
-	AssetCountMsg = GetAssetCountMsg();
+	ActiveJob.Reset();
+}
 
-	if (ConstructedAssetCountTextBlock.IsValid())
+TSharedRef<SWidget> SAssetActionsTab::ConstructJobProgress()
+{
+	return SNew(SHorizontalBox)
+		.Visibility(this, &SAssetActionsTab::GetJobProgressVisibility)
+
+		// Progress bar
+		+ SHorizontalBox::Slot()
+		.FillWidth(6.f)
+		.VAlign(VAlign_Center)
+		.Padding(5.f)
+		[
+			SNew(SProgressBar)
+			.Percent(this, &SAssetActionsTab::GetJobProgressPercent)
+		]
+
+		// Assets done, rate and time left
+		+ SHorizontalBox::Slot()
+		.FillWidth(8.f)
+		.VAlign(VAlign_Center)
+		.Padding(5.f)
+		[
+			SNew(STextBlock)
+			.Text(this, &SAssetActionsTab::GetJobProgressText)
+			.ColorAndOpacity(FColor::White)
+		]
+
+		// Cancel btn
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(5.f)
+		[
+			SNew(SButton)
+			.ContentPadding(FMargin(5.f))
+			.OnClicked(this, &SAssetActionsTab::OnCancelJobButtonClicked)
+			[
+				ConstructTextForButtonSlot(TEXT("Cancel"))
+			]
+		];
+}
+
+FReply SAssetActionsTab::OnCancelJobButtonClicked()
+{
+	if (ActiveJob.IsValid())
 	{
-		ConstructedAssetCountTextBlock->SetText(FText::FromString(AssetCountMsg));
-		ConstructedAssetCountTextBlock->Refresh();
+		ActiveJob->Cancel();
 	}
+
+	return FReply::Handled();
 }
 
-void SAssetActionsTab::FilterAssetData()
-/*
-	Call all the filter fns from the manager module and sets the appropriate asset data variable
-*/
+EVisibility SAssetActionsTab::GetJobProgressVisibility() const
 {
-	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+	return ActiveJob.IsValid() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+TOptional<float> SAssetActionsTab::GetJobProgressPercent() const
+{
+	return ActiveJob.IsValid() ? ActiveJob->GetProgressFraction() : 0.f;
+}
+
+FText SAssetActionsTab::GetJobProgressText() const
+{
+	if (!ActiveJob.IsValid()) { return FText::GetEmpty(); }
 
-	UnusedAssetsData = AssetActionsManager.FilterForUnusedAssetData(AllAssetsDataFromManager);
-	DuplicatedNameAssetsData = AssetActionsManager.FilterForDuplicateNameData(AllAssetsDataFromManager);
-	NoPrefixAssetsData = AssetActionsManager.FilterForNoPrefixData(AllAssetsDataFromManager);
+	return ActiveJob->IsCancelled() ? FText::FromString(TEXT("Cancelling after the current chunk...")) : ActiveJob->GetProgressText();
 }
 
-void SAssetActionsTab::EnsureAssetDeletionFromLists(const TSharedPtr<FAssetData>& AssetDataToDelete)
+#pragma endregion
+
+#pragma region TimeSlicedLoad
+
+void SAssetActionsTab::StartTimeSlicedLoad()
 /*
-	Remove deleted assets from all asset data arrays if they contain the deleted asset
+	Start from an empty list; a load that is already running picks up the new enumeration on its next tick,
+	so only one active timer is ever registered
 */
 {
-	if (DisplayedAssetsData.Contains(AssetDataToDelete))
-	{
-		DisplayedAssetsData.Remove(AssetDataToDelete);
-	}
+	DisplayedAssetsData.Reset();
+	RowsToEvaluate.Reset();
+	NumRowsEvaluated = 0;
 
-	if (AllAssetsDataFromManager.Contains(AssetDataToDelete))
-	{
-		AllAssetsDataFromManager.Remove(AssetDataToDelete);
-	}
+	// All memoized filter results refer to the previous asset data
+	++AssetDataGeneration;
 
-	if (UnusedAssetsData.Contains(AssetDataToDelete))
+	if (!bTimeSlicedLoadActive)
 	{
-		UnusedAssetsData.Remove(AssetDataToDelete);
+		bTimeSlicedLoadActive = true;
+		RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SAssetActionsTab::TickTimeSlicedLoad));
 	}
 
-	if (DuplicatedNameAssetsData.Contains(AssetDataToDelete))
+	if (ConstructedAssetListView.IsValid())
 	{
-		DuplicatedNameAssetsData.Remove(AssetDataToDelete);
+		ConstructedAssetListView->RebuildList();
 	}
 
-	if (NoPrefixAssetsData.Contains(AssetDataToDelete))
-	{
-		NoPrefixAssetsData.Remove(AssetDataToDelete);
-	}
+	RefreshAssetCountText();
+	TrackCheckBoxStateForHeader();
 }
 
-TMultiMap<FString, FString> SAssetActionsTab::GetCheckBoxAssetMap(const TArray<TSharedPtr<FAssetData>> CheckBoxStateArray)
+void SAssetActionsTab::BeginTimeSlicedFilter()
 /*
-	Returns a multimap of asset names to asset paths
-	This is important for setting a checkbox state to its previous state
+	The result rows are filled in as blocks are evaluated and the result only becomes current after the last block
 */
 {
-	TMultiMap<FString, FString> AssetMap;
+	RowsToEvaluate.Reset();
+	NumRowsEvaluated = 0;
+
+	if (IsFilterResultCurrent(SelectedFilter))
+	{
+		DisplayFilteredAssets();
+		return;
+	}
 
-	for (TSharedPtr<FAssetData> Asset : CheckBoxStateArray)
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+
+	for (TConstSetBitIterator<> It(AssetTable.GetLiveRows()); It; ++It)
 	{
-		AssetMap.Add(Asset->AssetName.ToString(), Asset->GetObjectPathString());
+		RowsToEvaluate.Add(It.GetIndex());
 	}
 
-	return AssetMap;
+	FFilterResult& FilterResult = FilterResults[static_cast<int32>(SelectedFilter)];
+	FilterResult.Rows.Init(false, AssetTable.GetMaxRows());
+	FilterResult.Generation = MAX_uint32;
 }
 
-void SAssetActionsTab::TrackCheckBoxStateForHeader()
+EActiveTimerReturnType SAssetActionsTab::TickTimeSlicedLoad(double InCurrentTime, float InDeltaTime)
 /*
-	Helper fn that checks state of assets and sets headercheckbox to appropriate state
+	Spend at most the frame budget listing folders or filtering rows, then show the rows that made it into the list.
+	Filters that compare assets with each other, like duplicate names, only start once every folder is listed.
 */
 {
-	// if row checkboxes have both states, set headercheckbox to undetermined
-	if (UncheckedAssets.Num() > 0 && CheckedAssets.Num() > 0)
+	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+	FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+
+	// A budget turned off during the load finishes it in this frame
+	double BudgetSeconds = AssetActionsManager.GetTimeSliceBudgetSeconds();
+
+	if (BudgetSeconds <= 0.0)
+	{
+		BudgetSeconds = TNumericLimits<float>::Max();
+	}
+
+	const int32 NumDisplayedBefore = DisplayedAssetsData.Num();
+
+	if (AssetActionsManager.IsEnumeratingAssetTable())
 	{
-		HeaderCheckBox->SetIsChecked(ECheckBoxState::Undetermined);
+		TArray<int32> AddedRows;
+		const bool bFoldersLeft = AssetActionsManager.StepAssetTableEnumeration(BudgetSeconds, AddedRows);
+
+		// Sort keys are rebuilt for the new rows if a column is sorted during the load
+		if (!AddedRows.IsEmpty())
+		{
+			++AssetDataGeneration;
+		}
+
+		AssetTable.PadRows(CheckedRows);
+
+		for (const int32 AddedRow : AddedRows)
+		{
+			const TSharedPtr<FAssetData>& AddedItem = AssetTable.GetItem(AddedRow);
+
+			if (CheckedAssetPathsToRestore.Remove(AddedItem->GetSoftObjectPath()) > 0)
+			{
+				CheckedRows[AddedRow] = true;
+				++NumCheckedRows;
+			}
+
+			if (SelectedFilter == EAssetActionsFilter::All)
+			{
+				DisplayedAssetsData.Add(AddedItem);
+			}
+		}
+
+		if (!bFoldersLeft)
+		{
+			CheckedAssetPathsToRestore.Empty();
+			BeginTimeSlicedFilter();
+		}
 	}
 
-	// if row checkboxes are all unchecked, set headercheckbox to unchecked
-	else if (CheckedAssets.Num() == 0)
+	else if (NumRowsEvaluated < RowsToEvaluate.Num())
 	{
-		HeaderCheckBox->SetIsChecked(ECheckBoxState::Unchecked);
+		ASSET_ACTIONS_SCOPE(TimeSlicedFilter);
+
+		FFilterResult& FilterResult = FilterResults[static_cast<int32>(SelectedFilter)];
+		const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+		TBitArray<> BlockRows;
+
+		do
+		{
+			const int32 BlockEnd = FMath::Min(NumRowsEvaluated + TimeSlicedFilterBlockSize, RowsToEvaluate.Num());
+
+			BlockRows.Init(false, AssetTable.GetMaxRows());
+
+			for (int32 Index = NumRowsEvaluated; Index < BlockEnd; ++Index)
+			{
+				BlockRows[RowsToEvaluate[Index]] = true;
+			}
+
+			const TBitArray<> PassedRows = AssetActionsManager.FilterAssetTable(SelectedFilter, BlockRows);
+
+			for (int32 Index = NumRowsEvaluated; Index < BlockEnd; ++Index)
+			{
+				const int32 Row = RowsToEvaluate[Index];
+
+				if (PassedRows[Row])
+				{
+					FilterResult.Rows[Row] = true;
+					DisplayedAssetsData.Add(AssetTable.GetItem(Row));
+				}
+			}
+
+			NumRowsEvaluated = BlockEnd;
+		} 
+		while (NumRowsEvaluated < RowsToEvaluate.Num() && FPlatformTime::Seconds() < EndTime);
+
+		if (NumRowsEvaluated == RowsToEvaluate.Num())
+		{
+			FilterResult.Generation = AssetDataGeneration;
+		}
 	}
 
-	// if row checkboxes are all checked, set headercheckbox to checked
-	else if (UncheckedAssets.Num() == 0)
+	if (DisplayedAssetsData.Num() != NumDisplayedBefore)
 	{
-		HeaderCheckBox->SetIsChecked(ECheckBoxState::Checked);
+		if (ConstructedAssetListView.IsValid())
+		{
+			ConstructedAssetListView->RequestListRefresh();
+		}
+
+		RefreshAssetCountText();
+	}
+
+	if (AssetActionsManager.IsEnumeratingAssetTable() || NumRowsEvaluated < RowsToEvaluate.Num())
+	{
+		return EActiveTimerReturnType::Continue;
+	}
+
+	FinishTimeSlicedLoad();
+
+	return EActiveTimerReturnType::Stop;
+}
+
+void SAssetActionsTab::FinishTimeSlicedLoad()
+/*
+	The one step of a load that is not sliced is the final sort. It sorts packed integer keys with no catalog
+	queries (unless sorting by referencer count, whose counts the unused filter has mostly cached already), 
+	so it costs far less than listing or filtering. Slicing it would show a list that reorders under the user 
+	between frames.
+*/
+{
+	bTimeSlicedLoadActive = false;
+	RowsToEvaluate.Empty();
+	NumRowsEvaluated = 0;
+	CheckedAssetPathsToRestore.Empty();
+
+	RefreshListView();
+	TrackCheckBoxStateForHeader();
+
+	if (!PendingAssetChanges.IsEmpty() && !bAssetChangesScheduled)
+	{
+		bAssetChangesScheduled = true;
+		RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SAssetActionsTab::ApplyPendingAssetChanges));
+	}
+}
+
+#pragma endregion
+
+#pragma region HelpfulInfoSlot
+
+TSharedRef<SRichTextBlock> SAssetActionsTab::ConstructTextForAssetCount()
+/*
+	Construct a textblock that can be dynamically refreshed that keeps track of displayed asset count
+*/
+{
+	const FTextBlockStyle TextBlockStyle = 
+		FTextBlockStyle().SetFont(SharedTextFont).SetColorAndOpacity(FColor::White);
+
+	ConstructedAssetCountTextBlock =
+		SNew(SRichTextBlock);
+		
+	ConstructedAssetCountTextBlock->SetText(FText::FromString(AssetCountMsg));
+	ConstructedAssetCountTextBlock->SetTextStyle(TextBlockStyle);
+
+	return ConstructedAssetCountTextBlock.ToSharedRef();
+}
+
+TSharedRef<STextBlock> SAssetActionsTab::ConstructTextForSelectedFolderPath()
+{
+	FString SelectedFolderPathsText;
+	FString SelectedFolderDisplayedText;
+
+	// when only one folder is selected, set text equal to only element
+	if (SelectedFoldersPaths.Num() == 1)
+	{
+		SelectedFolderPathsText = SelectedFoldersPaths[0];
+		SelectedFolderDisplayedText = SelectedFolderPathsText;
+	}
+
+	// else append each folder path with a + separator
+	else if (SelectedFoldersPaths.Num() > 1)
+	{
+		for (int i = 0; i < SelectedFoldersPaths.Num(); ++i)
+		{
+			// if last element in list, don't add + seperator
+			if (i == SelectedFoldersPaths.Num() - 1)
+			{
+				SelectedFolderPathsText.Append(SelectedFoldersPaths[i]);
+			}
+
+			else
+			{
+				SelectedFolderPathsText.Append(SelectedFoldersPaths[i] + TEXT(" + "));
+			}
+		}
+
+		if (SelectedFoldersPaths.Num() > 4)
+		{
+			SelectedFolderDisplayedText = 
+				TEXT("Too many folders selected to display. Refer to Content Browser");
+		}
+
+		SelectedFolderDisplayedText = SelectedFolderPathsText;
+	}
+
+	TSharedRef<STextBlock> ConstructedTextBlock =
+		SNew(STextBlock)
+		.Text(FText::FromString(TEXT("Selected folder path: ") + SelectedFolderDisplayedText))
+		.Font(SharedTextFont)
+		.ColorAndOpacity(FColor::White)
+		.AutoWrapText(true);
+
+	return ConstructedTextBlock;
+}
+
+#pragma endregion
+
+#pragma region HelperFunctions
+
+void SAssetActionsTab::RefreshWidget()
+/*
+	Refresh asset data and source items to ensure AssetListView and AssetCount is always up to date.
+	This re-enumerates all assets, so it is only used for a manual refresh; asset changes made while 
+	the tab is open are applied through ApplyAssetChanges.
+*/
+{
+	ASSET_ACTIONS_SCOPE(RefreshWidget);
+
+	// Call fix up redirectors fn from manager module
+	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+	AssetActionsManager.FixUpRedirectors();
+
+	// Remember checked assets by path since all asset table rows are recreated below; 
+	// during a load this keeps the checked assets that were not listed yet
+	for (const TSharedPtr<FAssetData>& CheckedAsset : GetCheckedAssets())
+	{
+		CheckedAssetPathsToRestore.Add(CheckedAsset->GetSoftObjectPath());
+	}
+
+	// Any pending changes are included in the new enumeration
+	PendingAssetChanges = FAssetActionsDelta();
+
+	CheckedRows.Reset();
+	NumCheckedRows = 0;
+
+	// With a frame budget the list fills progressively and checks are restored as rows are listed
+	if (AssetActionsManager.GetTimeSliceBudgetSeconds() > 0.0)
+	{
+		AssetActionsManager.BeginAssetTableEnumeration();
+		StartTimeSlicedLoad();
+		return;
+	}
+
+	// Refresh source items to pick up changes
+	AssetActionsManager.RefreshAssetTable();
+	FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+
+	CheckedRows.Init(false, AssetTable.GetMaxRows());
+
+	for (const FSoftObjectPath& CheckedAssetPath : CheckedAssetPathsToRestore)
+	{
+		const int32 Row = AssetTable.FindRow(CheckedAssetPath);
+
+		if (Row != INDEX_NONE && !CheckedRows[Row])
+		{
+			CheckedRows[Row] = true;
+			++NumCheckedRows;
+		}
+	}
+
+	CheckedAssetPathsToRestore.Empty();
+
+	// A load still running has nothing left to list or filter and finishes on its next tick
+	RowsToEvaluate.Reset();
+	NumRowsEvaluated = 0;
+
+	// All memoized filter results refer to the previous asset data
+	++AssetDataGeneration;
+
+	DisplayFilteredAssets();
+
+	// Refresh sorting
+	UpdateSorting();
+
+	// Refresh Asset List View
+	if (ConstructedAssetListView.IsValid())
+	{
+		ConstructedAssetListView->RebuildList();
+	}
+
+	RefreshAssetCountText();
+	TrackCheckBoxStateForHeader();
+}
+
+void SAssetActionsTab::RefreshListView()
+/*
+	Re-sort displayed assets and refresh the list view; rows for assets that are still displayed are reused
+*/
+{
+	UpdateSorting();
+
+	if (ConstructedAssetListView.IsValid())
+	{
+		ConstructedAssetListView->RequestListRefresh();
+	}
+
+	RefreshAssetCountText();
+}
+
+void SAssetActionsTab::RefreshAssetCountText()
+/*
+	Update asset count text to match the displayed assets
+*/
+{
+	AssetCountMsg = GetAssetCountMsg();
+
+	if (ConstructedAssetCountTextBlock.IsValid())
+	{
+		ConstructedAssetCountTextBlock->SetText(FText::FromString(AssetCountMsg));
+		ConstructedAssetCountTextBlock->Refresh();
+	}
+}
+
+const TBitArray<>& SAssetActionsTab::GetFilteredRows(EAssetActionsFilter Filter)
+/*
+	Return the asset table rows for a filter, calling the manager filter fn only when the memoized result 
+	was computed for an older generation of the listed assets
+*/
+{
+	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+	const FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+
+	if (Filter == EAssetActionsFilter::All)
+	{
+		return AssetTable.GetLiveRows();
+	}
+
+	FFilterResult& FilterResult = FilterResults[static_cast<int32>(Filter)];
+
+	if (FilterResult.Generation == AssetDataGeneration)
+	{
+		return FilterResult.Rows;
+	}
+
+	FilterResult.Rows = AssetActionsManager.FilterAssetTable(Filter, AssetTable.GetLiveRows());
+	FilterResult.Generation = AssetDataGeneration;
+
+	return FilterResult.Rows;
+}
+
+void SAssetActionsTab::DisplayFilteredAssets()
+/*
+	Gather the list items for the rows that pass the selected filter
+*/
+{
+	GetAssetTable().GetItems(GetFilteredRows(SelectedFilter), DisplayedAssetsData);
+}
+
+bool SAssetActionsTab::IsFilterResultCurrent(EAssetActionsFilter Filter) const
+{
+	return Filter == EAssetActionsFilter::All || 
+		FilterResults[static_cast<int32>(Filter)].Generation == AssetDataGeneration;
+}
+
+void SAssetActionsTab::ClearCheckedAssets()
+/*
+	Uncheck all assets; row checkboxes that are kept after a bulk action follow through their bound state
+*/
+{
+	CheckedRows.Init(false, GetAssetTable().GetMaxRows());
+	NumCheckedRows = 0;
+	SelectionAnchor.Reset();
+
+	OnCheckedRowsChanged();
+}
+
+ECheckBoxState SAssetActionsTab::GetCheckBoxState(TSharedPtr<FAssetData> AssetData) const
+{
+	return IsAssetChecked(AssetData) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+bool SAssetActionsTab::IsAssetChecked(const TSharedPtr<FAssetData>& AssetData) const
+/*
+	One lookup from list item to row and one bit test; called for every visible row each frame
+*/
+{
+	const int32 Row = GetAssetTable().FindRow(AssetData);
+
+	return CheckedRows.IsValidIndex(Row) && CheckedRows[Row];
+}
+
+bool SAssetActionsTab::SetAssetChecked(const TSharedPtr<FAssetData>& AssetData, bool bChecked)
+/*
+	Set the checked bit of the asset's row and keep the checked count in step; 
+	rows added after the tab was spawned grow the bitset first
+*/
+{
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+	const int32 Row = AssetTable.FindRow(AssetData);
+
+	if (Row == INDEX_NONE) return false;
+
+	AssetTable.PadRows(CheckedRows);
+
+	if (CheckedRows[Row] == bChecked) return false;
+
+	CheckedRows[Row] = bChecked;
+	NumCheckedRows += bChecked ? 1 : -1;
+
+	return true;
+}
+
+void SAssetActionsTab::SetRowsChecked(const TBitArray<>& Rows, bool bChecked)
+/*
+	Check or uncheck every asset table row set in Rows in one pass over the bitset, then update the 
+	header and visible rows once
+*/
+{
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+	AssetTable.PadRows(CheckedRows);
+
+	for (TConstSetBitIterator<> It(Rows); It; ++It)
+	{
+		const int32 Row = It.GetIndex();
+
+		if (!AssetTable.IsValidRow(Row) || CheckedRows[Row] == bChecked) continue;
+
+		CheckedRows[Row] = bChecked;
+		NumCheckedRows += bChecked ? 1 : -1;
+	}
+
+	OnCheckedRowsChanged();
+}
+
+void SAssetActionsTab::SetDisplayedAssetsChecked(bool bChecked)
+/*
+	The displayed assets are exactly the rows that pass the selected filter
+*/
+{
+	SetRowsChecked(GetFilteredRows(SelectedFilter), bChecked);
+}
+
+void SAssetActionsTab::SetDisplayedRangeChecked(int32 FirstIndex, int32 LastIndex, bool bChecked)
+/*
+	Check or uncheck the displayed assets between two list indices (inclusive, in either order)
+*/
+{
+	if (FirstIndex > LastIndex) { Swap(FirstIndex, LastIndex); }
+
+	FirstIndex = FMath::Max(FirstIndex, 0);
+	LastIndex = FMath::Min(LastIndex, DisplayedAssetsData.Num() - 1);
+
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+	TBitArray<> RangeRows(false, AssetTable.GetMaxRows());
+
+	for (int32 Index = FirstIndex; Index <= LastIndex; ++Index)
+	{
+		const int32 Row = AssetTable.FindRow(DisplayedAssetsData[Index]);
+
+		if (Row != INDEX_NONE)
+		{
+			RangeRows[Row] = true;
+		}
+	}
+
+	SetRowsChecked(RangeRows, bChecked);
+}
+
+void SAssetActionsTab::OnCheckedRowsChanged()
+/*
+	Row checkboxes read their state from the checked rows, so a bulk change only has to recount the header
+	and invalidate the list view once
+*/
+{
+	TrackCheckBoxStateForHeader();
+
+	if (ConstructedAssetListView.IsValid())
+	{
+		ConstructedAssetListView->Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+TArray<TSharedPtr<FAssetData>> SAssetActionsTab::GetCheckedAssets() const
+{
+	TArray<TSharedPtr<FAssetData>> CheckedAssets;
+	GetAssetTable().GetItems(CheckedRows, CheckedAssets);
+
+	return CheckedAssets;
+}
+
+void SAssetActionsTab::ClearRowState(int32 Row)
+/*
+	A removed row may be reused by the next added asset, so it must not stay checked or marked as passing a filter
+*/
+{
+	if (CheckedRows.IsValidIndex(Row) && CheckedRows[Row])
+	{
+		CheckedRows[Row] = false;
+		--NumCheckedRows;
+	}
+
+	for (FFilterResult& FilterResult : FilterResults)
+	{
+		if (FilterResult.Rows.IsValidIndex(Row))
+		{
+			FilterResult.Rows[Row] = false;
+		}
+	}
+}
+
+void SAssetActionsTab::TrackCheckBoxStateForHeader()
+/*
+	Helper fn that counts the checked displayed assets so the bound header checkbox shows the right state.
+	Called whenever the displayed assets or many checked rows change; single clicks and asset changes adjust 
+	the count directly.
+*/
+{
+	NumCheckedDisplayedAssets = 0;
+
+	if (NumCheckedRows == 0) return;
+
+	for (const TSharedPtr<FAssetData>& DisplayedAsset : DisplayedAssetsData)
+	{
+		if (IsAssetChecked(DisplayedAsset))
+		{
+			++NumCheckedDisplayedAssets;
+		}
+	}
+}
+
+#pragma endregion
+
+#pragma region AssetChanges
+
+void SAssetActionsTab::OnAssetDataChanged(const FAssetActionsDelta& Delta)
+/*
+	Collect asset changes and apply them once on the next Slate tick, so a bulk action that 
+	fires many registry events only updates the list once
+*/
+{
+	PendingAssetChanges.Append(Delta);
+
+	if (!bAssetChangesScheduled)
+	{
+		bAssetChangesScheduled = true;
+		RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SAssetActionsTab::ApplyPendingAssetChanges));
+	}
+}
+
+EActiveTimerReturnType SAssetActionsTab::ApplyPendingAssetChanges(double InCurrentTime, float InDeltaTime)
+/*
+	Apply the collected changes and stop the timer
+*/
+{
+	bAssetChangesScheduled = false;
+
+	// Kept until the load finishes, since the rows they refer to may not be listed yet
+	if (bTimeSlicedLoadActive) { return EActiveTimerReturnType::Stop; }
+
+	FAssetActionsDelta AssetChanges = MoveTemp(PendingAssetChanges);
+	PendingAssetChanges = FAssetActionsDelta();
+
+	if (!AssetChanges.IsEmpty())
+	{
+		ApplyAssetChanges(AssetChanges);
+	}
+
+	return EActiveTimerReturnType::Stop;
+}
+
+void SAssetActionsTab::ApplyAssetChanges(const FAssetActionsDelta& Delta)
+/*
+	Apply the assets that changed to the manager's asset table. Renamed assets are updated in place so their rows
+	and checkbox state survive; only changed rows and rows that share a name with them are filtered again. 
+	Changed rows are gathered as row indices and list items are found through their displayed index, so nothing 
+	here scans the table or the list.
+*/
+{
+	FAssetActionsManagerModule& AssetActionsManager = LoadManagerModule();
+	FAssetActionsTable& AssetTable = AssetActionsManager.GetAssetTable();
+
+	TArray<int32> DisplayedIndicesToRemove; // list items taken out of the displayed assets
+	TSet<int32> ChangedRows; // rows added or renamed
+	TSet<FName> ChangedNames; // old and new names of removed, added and renamed assets
+	bool bRowsRemoved = false;
+
+	// The header count follows every list item taken out or put in
+	auto TakeOutOfList = [this, &DisplayedIndicesToRemove](int32 Row)
+		{
+			const int32 DisplayedIndex = GetDisplayedIndex(Row);
+
+			if (DisplayedIndex == INDEX_NONE) return;
+
+			DisplayedIndicesToRemove.Add(DisplayedIndex);
+			DisplayedIndexByRow[Row] = INDEX_NONE;
+
+			if (CheckedRows.IsValidIndex(Row) && CheckedRows[Row])
+			{
+				--NumCheckedDisplayedAssets;
+			}
+		};
+
+	auto RemoveRow = [this, &AssetTable, &ChangedRows, &bRowsRemoved, &TakeOutOfList](int32 Row)
+		{
+			TakeOutOfList(Row);
+			ClearRowState(Row);
+			AssetTable.RemoveRow(Row);
+
+			// A row renamed earlier in the batch may be moved out by a later rename
+			ChangedRows.Remove(Row);
+			bRowsRemoved = true;
+		};
+
+	for (const FSoftObjectPath& RemovedAssetPath : Delta.RemovedAssets)
+	{
+		const int32 RemovedRow = AssetTable.FindRow(RemovedAssetPath);
+
+		if (RemovedRow == INDEX_NONE) continue;
+
+		ChangedNames.Add(AssetTable.GetAssetName(RemovedRow));
+		RemoveRow(RemovedRow);
+	}
+
+	for (const TPair<FSoftObjectPath, FAssetData>& RenamedAsset : Delta.RenamedAssets)
+	{
+		int32 RenamedRow = AssetTable.FindRow(RenamedAsset.Key);
+		const bool bListedAfterRename = AssetActionsManager.IsAssetInFolders(RenamedAsset.Value, SelectedFoldersPaths);
+
+		if (RenamedRow != INDEX_NONE)
+		{
+			ChangedNames.Add(AssetTable.GetAssetName(RenamedRow));
+
+			// Moved out of the selected folders
+			if (!bListedAfterRename)
+			{
+				RemoveRow(RenamedRow);
+				continue;
+			}
+
+			// Update in place so the row widget and checkbox state are kept
+			AssetTable.UpdateRow(RenamedRow, RenamedAsset.Value);
+		}
+
+		// Moved into the selected folders from elsewhere, unless a load already listed it at its new path
+		else if (bListedAfterRename && AssetTable.FindRow(RenamedAsset.Value.GetSoftObjectPath()) == INDEX_NONE)
+		{
+			RenamedRow = AssetTable.AddRow(RenamedAsset.Value);
+		}
+
+		else continue;
+
+		ChangedRows.Add(RenamedRow);
+		ChangedNames.Add(AssetTable.GetAssetName(RenamedRow));
+	}
+
+	for (const FAssetData& AddedAsset : Delta.AddedAssets)
+	{
+		if (AssetTable.FindRow(AddedAsset.GetSoftObjectPath()) != INDEX_NONE) continue;
+
+		if (!AssetActionsManager.IsAssetInFolders(AddedAsset, SelectedFoldersPaths)) continue;
+
+		ChangedRows.Add(AssetTable.AddRow(AddedAsset));
+		ChangedNames.Add(AddedAsset.AssetName);
+	}
+
+	// Assets whose referencer count changed may have become used or unused, and move when sorted by count
+	TSet<int32> RefCountChangedRows;
+	TArray<int32> FoundRows;
+
+	for (const FName& PackageName : Delta.ReferencersChangedPackages)
+	{
+		AssetTable.FindRowsByPackageName(PackageName, FoundRows);
+	}
+
+	RefCountChangedRows.Append(FoundRows);
+
+	TSet<int32> ReferencersChangedRows = ChangedRows;
+	ReferencersChangedRows.Append(RefCountChangedRows);
+
+	// Assets sharing a name with a changed asset may have gained or lost a duplicate
+	TSet<int32> DuplicateCandidateRows;
+	FoundRows.Reset();
+
+	for (const FName& ChangedName : ChangedNames)
+	{
+		AssetTable.FindRowsByAssetName(ChangedName, FoundRows);
+	}
+
+	DuplicateCandidateRows.Append(FoundRows);
+
+	// Rows whose package became reachable or unreachable, possibly far from the changed assets
+	if (Delta.bReachabilityChanged)
+	{
+		TArray<FName> ReachabilityChangedPackages;
+		AssetActionsManager.TakeReachabilityChanges(ReachabilityChangedPackages);
+
+		FoundRows.Reset();
+
+		for (const FName& PackageName : ReachabilityChangedPackages)
+		{
+			AssetTable.FindRowsByPackageName(PackageName, FoundRows);
+		}
+
+		ReferencersChangedRows.Append(FoundRows);
+	}
+
+	if (!bRowsRemoved && ReferencersChangedRows.IsEmpty() && DuplicateCandidateRows.IsEmpty() && !Delta.bFilterSettingsChanged) return;
+
+	// Only the displayed filter is patched; other memoized filters go stale with the new generation. 
+	// Edited filter settings make every memoized result stale, including the displayed one.
+	const bool bPatchDisplayedFilter = IsFilterResultCurrent(SelectedFilter) && !Delta.bFilterSettingsChanged;
+	const bool bSortKeysCurrent = SortKeysGeneration == AssetDataGeneration;
+	const bool bRefCountKeysCurrent = RefCountKeysGeneration == AssetDataGeneration;
+	++AssetDataGeneration;
+
+	// Sort keys carry over to the new generation once the changed rows are ranked, so the next sort reuses them
+	if (bSortKeysCurrent && PatchSortKeys(ChangedRows.Array()))
+	{
+		SortKeysGeneration = AssetDataGeneration;
+
+		if (bRefCountKeysCurrent)
+		{
+			auto PatchRefCounts = [this, &AssetActionsManager, &AssetTable](const TSet<int32>& PatchedRows)
+				{
+					for (const int32 Row : PatchedRows)
+					{
+						SortKeys[Row].RefCount = static_cast<uint32>(AssetActionsManager.GetAssetReferencersCount(AssetTable.GetItem(Row)));
+					}
+				};
+
+			PatchRefCounts(ChangedRows);
+			PatchRefCounts(RefCountChangedRows);
+
+			RefCountKeysGeneration = AssetDataGeneration;
+		}
+	}
+
+	// Otherwise filter all assets for the displayed filter
+	if (!bPatchDisplayedFilter)
+	{
+		DisplayFilteredAssets();
+		RefreshListView();
+		TrackCheckBoxStateForHeader();
+		return;
+	}
+
+	const TSet<int32>* RowsToReevaluate = &ChangedRows;
+
+	switch (SelectedFilter)
+	{
+	case EAssetActionsFilter::Unused:
+		RowsToReevaluate = &ReferencersChangedRows;
+		break;
+
+	case EAssetActionsFilter::DuplicateName:
+		RowsToReevaluate = &DuplicateCandidateRows;
+		break;
+
+	default:
+		break;
+	}
+
+	// Filter only the rows that changed
+	const TArray<int32> Rows = RowsToReevaluate->Array();
+	const TBitArray<> PassedRows = AssetActionsManager.FilterAssetTableRows(SelectedFilter, Rows);
+
+	FFilterResult* FilterResult = nullptr;
+
+	if (SelectedFilter != EAssetActionsFilter::All)
+	{
+		FilterResult = &FilterResults[static_cast<int32>(SelectedFilter)];
+		AssetTable.PadRows(FilterResult->Rows);
+		FilterResult->Generation = AssetDataGeneration;
+	}
+
+	// A change in referencer counts moves rows when sorting by count; sets of duplicate names are keyed by 
+	// name, so only renamed rows move between them
+	const bool bSortByRefCount = SortByColumn == AssetActionsColumns::RefCount || SecondarySortByColumn == AssetActionsColumns::RefCount;
+	TArray<int32> RowsToInsert;
+
+	auto PutInList = [this, &RowsToInsert](int32 Row)
+		{
+			RowsToInsert.Add(Row);
+
+			if (CheckedRows.IsValidIndex(Row) && CheckedRows[Row])
+			{
+				++NumCheckedDisplayedAssets;
+			}
+		};
+
+	for (int32 Index = 0; Index < Rows.Num(); ++Index)
+	{
+		const int32 Row = Rows[Index];
+		const bool bPassed = PassedRows[Index];
+
+		if (FilterResult)
+		{
+			FilterResult->Rows[Row] = bPassed;
+		}
+
+		const bool bMoved = ChangedRows.Contains(Row) || (bSortByRefCount && RefCountChangedRows.Contains(Row));
+
+		// Rows that still pass and keep their sort position stay where they are
+		if (bPassed && !bMoved && GetDisplayedIndex(Row) != INDEX_NONE) continue;
+
+		TakeOutOfList(Row);
+
+		if (bPassed)
+		{
+			PutInList(Row);
+		}
+	}
+
+	// Displayed rows that were not filtered again still move to their new count
+	if (bSortByRefCount)
+	{
+		for (const int32 Row : RefCountChangedRows)
+		{
+			if (RowsToReevaluate->Contains(Row) || GetDisplayedIndex(Row) == INDEX_NONE) continue;
+
+			TakeOutOfList(Row);
+			PutInList(Row);
+		}
+	}
+
+	PatchDisplayedAssets(DisplayedIndicesToRemove, RowsToInsert);
+
+	// Rows that are still displayed keep their widgets
+	if (ConstructedAssetListView.IsValid())
+	{
+		ConstructedAssetListView->RequestListRefresh();
+	}
+
+	RefreshAssetCountText();
+}
+
+int32 SAssetActionsTab::GetDisplayedIndex(int32 Row) const
+{
+	return DisplayedIndexByRow.IsValidIndex(Row) ? DisplayedIndexByRow[Row] : INDEX_NONE;
+}
+
+void SAssetActionsTab::PatchDisplayedAssets(TArray<int32>& DisplayedIndicesToRemove, TArray<int32>& RowsToInsert)
+/*
+	Compact the list from the first removed index, then fill it from the back with the sorted new rows. Insert 
+	positions are searched after the compaction, since renamed items sit at their old positions until then.
+*/
+{
+	const FAssetActionsTable& AssetTable = GetAssetTable();
+
+	if (!DisplayedIndicesToRemove.IsEmpty())
+	{
+		Algo::Sort(DisplayedIndicesToRemove);
+
+		int32 WriteIndex = DisplayedIndicesToRemove[0];
+		int32 NextRemoved = 0;
+
+		for (int32 ReadIndex = WriteIndex; ReadIndex < DisplayedAssetsData.Num(); ++ReadIndex)
+		{
+			if (NextRemoved < DisplayedIndicesToRemove.Num() && DisplayedIndicesToRemove[NextRemoved] == ReadIndex)
+			{
+				++NextRemoved;
+				continue;
+			}
+
+			DisplayedIndexByRow[AssetTable.FindRow(DisplayedAssetsData[ReadIndex])] = WriteIndex;
+			DisplayedAssetsData[WriteIndex++] = MoveTemp(DisplayedAssetsData[ReadIndex]);
+		}
+
+		DisplayedAssetsData.SetNum(WriteIndex, EAllowShrinking::No);
+	}
+
+	if (RowsToInsert.IsEmpty()) return;
+
+	const FAssetSortPredicate SortPredicate = GetSortPredicate();
+	auto SortPredicateRef = [&SortPredicate](const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B) { return SortPredicate(A, B); };
+
+	Algo::StableSort(RowsToInsert, [&AssetTable, &SortPredicate](int32 A, int32 B) { return SortPredicate(AssetTable.GetItem(A), AssetTable.GetItem(B)); });
+
+	// Positions among the items already listed; ascending since the rows are sorted
+	TArray<int32> InsertIndices;
+	InsertIndices.Reserve(RowsToInsert.Num());
+
+	for (const int32 Row : RowsToInsert)
+	{
+		InsertIndices.Add(Algo::UpperBound(DisplayedAssetsData, AssetTable.GetItem(Row), SortPredicateRef));
+	}
+
+	// Rows added by this batch may lie past the end of the index
+	DisplayedIndexByRow.Reserve(AssetTable.GetMaxRows());
+
+	while (DisplayedIndexByRow.Num() < AssetTable.GetMaxRows())
+	{
+		DisplayedIndexByRow.Add(INDEX_NONE);
+	}
+
+	int32 ReadIndex = DisplayedAssetsData.Num() - 1;
+	DisplayedAssetsData.AddDefaulted(RowsToInsert.Num());
+	int32 WriteIndex = DisplayedAssetsData.Num() - 1;
+
+	for (int32 InsertIndex = RowsToInsert.Num() - 1; InsertIndex >= 0; --InsertIndex)
+	{
+		for (; ReadIndex >= InsertIndices[InsertIndex]; --ReadIndex, --WriteIndex)
+		{
+			DisplayedIndexByRow[AssetTable.FindRow(DisplayedAssetsData[ReadIndex])] = WriteIndex;
+			DisplayedAssetsData[WriteIndex] = MoveTemp(DisplayedAssetsData[ReadIndex]);
+		}
+
+		DisplayedIndexByRow[RowsToInsert[InsertIndex]] = WriteIndex;
+		DisplayedAssetsData[WriteIndex--] = AssetTable.GetItem(RowsToInsert[InsertIndex]);
 	}
 }
 
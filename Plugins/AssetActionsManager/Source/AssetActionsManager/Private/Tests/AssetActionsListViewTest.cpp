@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsManager.h"
+#include "Algo/Count.h"
+#include "AssetActionsMemoryCatalog.h"
+#include "AssetActionsRegistryCatalog.h"
+#include "Misc/AutomationTest.h"
+#include "SlateWidgets/AssetActionsWidget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetActionsListViewRowsTest, "AssetActionsManager.ListView.RowWidgetsStayBounded",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAssetActionsListViewRowsTest::RunTest(const FString& Parameters)
+/*
+	Build the tab over a large synthetic catalog and scroll its list view from top to bottom a few times, rebuilding
+	the list on the way. Row widgets hold no state of their own, so the list view only keeps the rows in view and 
+	the number of generated rows must not grow with scrolling or with the number of assets. Rows scrolled out of 
+	view must also be released, so the live row widgets and the memory in use stay flat from one pass to the next.
+*/
+{
+	constexpr int32 NumAssets = 50000;
+	constexpr int32 AssetsPerFolder = 100;
+	constexpr int32 NumPasses = 3;
+	constexpr int32 NumScrollSteps = 40;
+
+	// Slack for allocations the editor makes on its own while the test runs; rows kept alive across three passes 
+	// over 50000 assets would grow well past it
+	constexpr int64 MaxUsedPhysicalGrowth = 16 * 1024 * 1024;
+
+	FAssetActionsManagerModule& AssetActionsManager =
+		FModuleManager::LoadModuleChecked<FAssetActionsManagerModule>(TEXT("AssetActionsManager"));
+
+	// Replacing the catalog would empty the table under the open tab
+	if (AssetActionsManager.IsAssetActionsTabOpen())
+	{
+		AddWarning(TEXT("Skipped while the Quick Asset Actions tab is open"));
+		return true;
+	}
+
+	const TArray<FString> PreviousFolderPaths = AssetActionsManager.GetSelectedFolderPaths();
+
+	TSharedRef<FAssetActionsMemoryCatalog> Catalog = MakeShared<FAssetActionsMemoryCatalog>();
+	Catalog->Reserve(NumAssets);
+
+	for (int32 Index = 0; Index < NumAssets; ++Index)
+	{
+		const FString PackagePath = FString::Printf(TEXT("/Game/AssetActionsTest/Folder%04d"), Index / AssetsPerFolder);
+		const FString AssetName = FString::Printf(TEXT("SM_Asset%07d"), Index);
+
+		Catalog->AddAsset(FAssetData(FName(PackagePath / AssetName), FName(PackagePath), FName(AssetName),
+			FTopLevelAssetPath(TEXT("/Script/Engine.StaticMesh"))));
+	}
+
+	const TArray<FString> FolderPaths = { TEXT("/Game/AssetActionsTest") };
+
+	AssetActionsManager.SetCatalog(Catalog);
+	AssetActionsManager.RefreshAssetTableForFolders(FolderPaths);
+
+	{
+		TSharedRef<SAssetActionsTab> AssetActionsTab = SNew(SAssetActionsTab).SelectedFoldersPaths(FolderPaths);
+		TSharedPtr<SListView<TSharedPtr<FAssetData>>> AssetListView = AssetActionsTab->GetAssetListViewForTesting();
+
+		if (!TestTrue(TEXT("The tab constructs its list view"), AssetListView.IsValid()))
+		{
+			AssetActionsManager.SetCatalog(MakeShared<FAssetActionsRegistryCatalog>());
+			AssetActionsManager.SetSelectedFolderPaths(PreviousFolderPaths);
+			return false;
+		}
+
+		TestEqual(TEXT("Every asset is listed"), AssetListView->GetNumItemsBeingObserved(), NumAssets);
+
+		// Rows are generated when the list view ticks with a size, as it would when shown in a window
+		const FGeometry ListGeometry = FGeometry::MakeRoot(FVector2D(800.f, 600.f), FSlateLayoutTransform());
+		double CurrentTime = 0.0;
+
+		auto TickListView = [&AssetListView, &ListGeometry, &CurrentTime]()
+			{
+				CurrentTime += 1.0 / 60.0;
+				AssetListView->SlatePrepass();
+				AssetListView->Tick(ListGeometry, CurrentTime, 1.f / 60.f);
+			};
+
+		TickListView();
+
+		const int32 NumRowsInView = AssetListView->GetNumGeneratedChildren();
+		TestTrue(TEXT("Rows are generated for the assets in view"), NumRowsInView > 0);
+
+		int32 MaxGeneratedRows = NumRowsInView;
+
+		// Every row widget generated while scrolling, held weakly so the test itself keeps none of them alive
+		const TArray<TSharedPtr<FAssetData>>& DisplayedAssets = AssetActionsTab->GetDisplayedAssetsForTesting();
+		TArray<TWeakPtr<SWidget>> GeneratedRowWidgets;
+
+		auto TrackRowsInView = [&AssetListView, &DisplayedAssets, &GeneratedRowWidgets, NumRowsInView](int32 FirstIndex)
+			{
+				const int32 EndIndex = FMath::Min(FirstIndex + NumRowsInView + 2, DisplayedAssets.Num());
+
+				for (int32 Index = FirstIndex; Index < EndIndex; ++Index)
+				{
+					if (TSharedPtr<ITableRow> RowWidget = AssetListView->WidgetFromItem(DisplayedAssets[Index]))
+					{
+						GeneratedRowWidgets.Add(RowWidget->AsWidget());
+					}
+				}
+			};
+
+		// The first pass warms up caches the later passes reuse, so memory is measured from its end
+		int64 UsedPhysicalAfterFirstPass = 0;
+
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			for (int32 Step = 0; Step <= NumScrollSteps; ++Step)
+			{
+				const int32 ScrollIndex = (NumAssets - NumRowsInView) * Step / NumScrollSteps;
+
+				AssetListView->SetScrollOffset(static_cast<float>(ScrollIndex));
+				TickListView();
+				TrackRowsInView(ScrollIndex);
+
+				MaxGeneratedRows = FMath::Max(MaxGeneratedRows, AssetListView->GetNumGeneratedChildren());
+			}
+
+			AssetListView->RebuildList();
+			TickListView();
+
+			MaxGeneratedRows = FMath::Max(MaxGeneratedRows, AssetListView->GetNumGeneratedChildren());
+
+			if (Pass == 0)
+			{
+				UsedPhysicalAfterFirstPass = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+			}
+		}
+
+		const int64 UsedPhysicalGrowth = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - UsedPhysicalAfterFirstPass;
+
+		const int32 NumLiveRowWidgets = Algo::CountIf(GeneratedRowWidgets, 
+			[](const TWeakPtr<SWidget>& RowWidget) { return RowWidget.IsValid(); });
+
+		// A partly visible row at either end of the view may be generated on top of the rows that fit
+		TestTrue(FString::Printf(TEXT("Generated rows stay bounded by the view (%d in view, at most %d while scrolling)"), 
+			NumRowsInView, MaxGeneratedRows), MaxGeneratedRows <= NumRowsInView + 2);
+
+		TestTrue(FString::Printf(TEXT("Rows scrolled out of view are released (%d of %d tracked row widgets still alive)"), 
+			NumLiveRowWidgets, GeneratedRowWidgets.Num()), NumLiveRowWidgets <= NumRowsInView + 2);
+
+		TestTrue(FString::Printf(TEXT("Memory in use stays flat after the first pass (grew %lld bytes)"), UsedPhysicalGrowth),
+			UsedPhysicalGrowth <= MaxUsedPhysicalGrowth);
+	}
+
+	// Put the project back rather than holding the synthetic catalog
+	AssetActionsManager.SetCatalog(MakeShared<FAssetActionsRegistryCatalog>());
+	AssetActionsManager.SetSelectedFolderPaths(PreviousFolderPaths);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
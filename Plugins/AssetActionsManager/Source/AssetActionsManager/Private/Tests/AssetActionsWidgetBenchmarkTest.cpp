@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AssetActionsManager.h"
+#include "AssetActionsMemoryCatalog.h"
+#include "AssetActionsRegistryCatalog.h"
+#include "Commandlets/AssetActionsBenchmarkCommandlet.h"
+#include "Dom/JsonValue.h"
+#include "Misc/AutomationTest.h"
+#include "SlateWidgets/AssetActionsWidget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAssetActionsWidgetBenchmarkTest, "AssetActionsManager.Benchmark.Widget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAssetActionsWidgetBenchmarkTest::RunTest(const FString& Parameters)
+/*
+	Time the stages of the tab that need Slate over the benchmark commandlet's synthetic catalogs, and report them 
+	the same way. Run with: UnrealEditor-Cmd <Project> -nullrhi -ExecCmds="Automation RunTests AssetActionsManager.Benchmark.Widget; Quit"
+	
+	Sorting reorders every displayed asset, so it should grow with n log n. Row generation rebuilds the rows in 
+	view, so it should stay flat as the catalog grows.
+*/
+{
+	using FStageResult = UAssetActionsBenchmarkCommandlet::FStageResult;
+
+	const int32 Sizes[] = { 1000, 10000, 100000 };
+	constexpr int32 Iterations = 5;
+
+	FAssetActionsManagerModule& AssetActionsManager =
+		FModuleManager::LoadModuleChecked<FAssetActionsManagerModule>(TEXT("AssetActionsManager"));
+
+	// Replacing the catalog would empty the table under the open tab
+	if (AssetActionsManager.IsAssetActionsTabOpen())
+	{
+		AddWarning(TEXT("Skipped while the Quick Asset Actions tab is open"));
+		return true;
+	}
+
+	const TArray<FString> PreviousFolderPaths = AssetActionsManager.GetSelectedFolderPaths();
+
+	TArray<TSharedPtr<FJsonValue>> ReportValues;
+	TMap<FString, FStageResult> PreviousResults;
+
+	auto Report = [&ReportValues, &PreviousResults](const FStageResult& Result)
+		{
+			UAssetActionsBenchmarkCommandlet::ReportStage(Result, PreviousResults.Find(Result.Stage), ReportValues);
+			PreviousResults.Add(Result.Stage, Result);
+		};
+
+	const TArray<FString> SyntheticFolderPaths = { TEXT("/Game/Benchmark") };
+
+	// Rows are generated when the list view ticks with a size, as it would when shown in a window
+	const FGeometry ListGeometry = FGeometry::MakeRoot(FVector2D(800.f, 600.f), FSlateLayoutTransform());
+	double CurrentTime = 0.0;
+
+	for (const int32 NumAssets : Sizes)
+	{
+		AssetActionsManager.SetCatalog(UAssetActionsBenchmarkCommandlet::GenerateCatalog(NumAssets));
+		AssetActionsManager.RefreshAssetTableForFolders(SyntheticFolderPaths);
+
+		TSharedRef<SAssetActionsTab> AssetActionsTab = SNew(SAssetActionsTab).SelectedFoldersPaths(SyntheticFolderPaths);
+		TSharedPtr<SListView<TSharedPtr<FAssetData>>> AssetListView = AssetActionsTab->GetAssetListViewForTesting();
+
+		if (!TestTrue(TEXT("The tab constructs its list view"), AssetListView.IsValid())) break;
+
+		auto TickListView = [&AssetListView, &ListGeometry, &CurrentTime]()
+			{
+				CurrentTime += 1.0 / 60.0;
+				AssetListView->SlatePrepass();
+				AssetListView->Tick(ListGeometry, CurrentTime, 1.f / 60.f);
+			};
+
+		// Each run sorts the list from name order into path order
+		Report(UAssetActionsBenchmarkCommandlet::RunStage(TEXT("UpdateSorting"), NumAssets, Iterations,
+			[&AssetActionsTab] { AssetActionsTab->SortByColumnForTesting(AssetActionsColumns::Name, EColumnSortMode::Ascending); },
+			[&AssetActionsTab] { AssetActionsTab->SortByColumnForTesting(AssetActionsColumns::Path, EColumnSortMode::Ascending); }));
+
+		// The cold run also queries and caches every referencer count
+		Report(UAssetActionsBenchmarkCommandlet::RunStage(TEXT("UpdateSortingByRefCount"), NumAssets, Iterations,
+			[&AssetActionsTab] { AssetActionsTab->SortByColumnForTesting(AssetActionsColumns::Name, EColumnSortMode::Ascending); },
+			[&AssetActionsTab] { AssetActionsTab->SortByColumnForTesting(AssetActionsColumns::RefCount, EColumnSortMode::Descending); }));
+
+		TickListView();
+
+		Report(UAssetActionsBenchmarkCommandlet::RunStage(TEXT("OnGenerateRowForListView"), NumAssets, Iterations,
+			[&AssetListView] { AssetListView->RebuildList(); },
+			[&TickListView] { TickListView(); }));
+
+		TestTrue(TEXT("Rows are generated for the assets in view"), AssetListView->GetNumGeneratedChildren() > 0);
+	}
+
+	// Put the project back rather than holding the largest synthetic catalog
+	AssetActionsManager.SetCatalog(MakeShared<FAssetActionsRegistryCatalog>());
+	AssetActionsManager.SetSelectedFolderPaths(PreviousFolderPaths);
+
+	return TestTrue(TEXT("The report is written"), 
+		UAssetActionsBenchmarkCommandlet::WriteReport(TEXT("Widget"), ReportValues, Iterations, UAssetActionsBenchmarkCommandlet::GetDefaultOutputDir()));
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+
+class IAssetActionsCatalog;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * On-disk cache of the assets listed for a set of folders and the referencers of their packages
+ *
+ * @note: The file is a header followed by fixed-size tables (string entries, asset records, referencer string
+ *		  indices) and a UTF-8 string blob. It is memory-mapped and read in place; only the strings of records that
+ *		  are still valid are turned into names. Each record carries the timestamp of its package file, and so does
+ *		  every cached referencer outside the records, so only packages whose file changed are queried again.
+ *		  Timestamps are compared for equality, so files synced or copied with an older time are still seen.
+ */
+class FAssetActionsAuditCache
+{
+public:
+
+	FAssetActionsAuditCache();
+	~FAssetActionsAuditCache();
+
+	/** Get the cache file for a set of folders under Saved/AssetActionsManager */
+	static FString GetFilename(const TArray<FString>& FolderPaths);
+
+	/**
+	 * Write a cache for a set of folders
+	 *
+	 * @param PackageTimestamps: timestamps of the assets' packages and of the packages referencing them
+	 * @note: Assets without a package file, e.g. new unsaved assets, are left out, and so are referencer lists
+	 *		  that name a package without a timestamp.
+	 */
+	static bool Save(const TArray<FString>& FolderPaths, const TArray<TSharedPtr<FAssetData>>& Assets,
+		const TMap<FName, FDateTime>& PackageTimestamps, const TMap<FName, TArray<FName>>& Referencers);
+
+	/**
+	 * Map the cache for a set of folders
+	 *
+	 * @return bool: false if there is no cache or it was written by another version or for other folders
+	 */
+	bool Load(const TArray<FString>& FolderPaths);
+
+	/**
+	 * Split the cached data into what is still valid and the packages that have to be queried again
+	 *
+	 * @param FolderPackageTimestamps: timestamp of every package file under the cached folders
+	 * @param OutValidAssets: cached assets whose package file is unchanged
+	 * @param OutValidReferencers: cached referencers of packages that no changed, new or deleted package could affect
+	 * @param OutChangedPackages: packages under the folders that are new or changed since the cache was written
+	 * @note: A changed package can gain or lose a reference to any package, so the cached referencers of everything
+	 *		  a changed package depends on now are dropped as well. Those dependencies come from the catalog, and so
+	 *		  do the timestamps of cached referencers outside the folders. A package added outside the folders is
+	 *		  not seen here, so the caller checks each valid referencer list against the catalog before using it.
+	 */
+	void Revalidate(const IAssetActionsCatalog& Catalog, const TMap<FName, FDateTime>& FolderPackageTimestamps, TArray<FAssetData>& OutValidAssets,
+		TMap<FName, TArray<FName>>& OutValidReferencers, TArray<FName>& OutChangedPackages);
+
+private:
+
+#pragma region Format
+
+	static constexpr uint32 CacheMagic = 0x41414143; // "AAAC"
+	static constexpr uint32 CacheVersion = 2;
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 FoldersKey;
+		int32 NumStrings;
+		int32 NumRecords;
+		int32 NumStamps;
+		int32 NumReferencers;
+		int32 StringDataSize;
+		int32 Padding;
+	};
+
+	/** Location of one string in the string blob */
+	struct FStringEntry
+	{
+		uint32 Offset;
+		uint32 Length;
+	};
+
+	/** One cached asset; names are indices into the string entries */
+	struct FRecord
+	{
+		int64 TimestampTicks;
+		int32 PackageName;
+		int32 PackagePath;
+		int32 AssetName;
+		int32 ClassPackageName;
+		int32 ClassAssetName;
+
+		/** First index into the referencer table, or INDEX_NONE if the package's referencers were not cached */
+		int32 FirstReferencer;
+		int32 NumReferencers;
+		int32 Padding;
+	};
+
+	/** Timestamp of a referencer package that has no record */
+	struct FStamp
+	{
+		int64 TimestampTicks;
+		int32 PackageName;
+		int32 Padding;
+	};
+
+	/** Byte offsets of each table, derived from the counts in the header */
+	struct FLayout
+	{
+		int64 StringEntries;
+		int64 Records;
+		int64 Stamps;
+		int64 Referencers;
+		int64 StringData;
+		int64 Total;
+	};
+
+	static FLayout GetLayout(const FHeader& Header);
+
+	/** Key identifying a set of folders regardless of their order */
+	static uint64 GetFoldersKey(const TArray<FString>& FolderPaths);
+
+	/** Check every count, offset and index against the file size so reads need no further checks */
+	bool IsValidCache(uint64 FoldersKey) const;
+
+#pragma endregion
+
+#pragma region MappedData
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** File contents when the platform cannot map files */
+	TArray<uint8> LoadedData;
+
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+
+	/** Names decoded from the string blob so far, by string index */
+	TArray<FName> DecodedNames;
+
+	const FHeader& GetHeader() const { return *reinterpret_cast<const FHeader*>(Data); }
+	const FStringEntry* GetStringEntries() const;
+	const FRecord* GetRecords() const;
+	const FStamp* GetStamps() const;
+	const int32* GetReferencers() const;
+
+	/** Decode a string to a name, once per string */
+	FName GetName(int32 StringIndex);
+
+	/** Release the mapping or loaded data */
+	void Unload();
+
+#pragma endregion
+};
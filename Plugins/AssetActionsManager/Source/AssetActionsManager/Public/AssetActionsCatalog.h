@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AssetRegistry/ARFilter.h"
+#include "AssetRegistry/AssetData.h"
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCatalogAssetChanged, const FAssetData&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnCatalogAssetRenamed, const FAssetData&, const FString&);
+
+/**
+ * Source of the assets, package references and asset operations the manager works on
+ *
+ * @note: The manager never calls the asset registry, asset tools or object tools itself, so its enumeration,
+ *		  caches and filters run the same against the project (FAssetActionsRegistryCatalog) and against
+ *		  synthetic data (FAssetActionsMemoryCatalog). Operations save whatever they change.
+ *
+ *		  Queries may be called from several worker threads at once while no operation is running, so
+ *		  implementations must not modify shared state in them. Operations are only called on the game thread.
+ */
+class IAssetActionsCatalog
+{
+public:
+
+	virtual ~IAssetActionsCatalog() = default;
+
+#pragma region Queries
+
+	/**
+	 * Get the assets matching a filter
+	 *
+	 * @note: Every catalog honors PackageNames, PackagePaths, bRecursivePaths and ClassPaths; other filter
+	 *		  fields may be ignored. Redirectors are returned like any other asset.
+	 */
+	virtual void GetAssets(const FARFilter& Filter, TArray<FAssetData>& OutAssets) const = 0;
+
+	/** Get every folder under a folder, recursively, without the folder itself */
+	virtual void GetSubPaths(const FName& PackagePath, TArray<FName>& OutSubPaths) const = 0;
+
+	/** Get the packages that reference a package */
+	virtual void GetReferencers(const FName& PackageName, TArray<FName>& OutReferencers) const = 0;
+
+	/** Get the packages a package references */
+	virtual void GetDependencies(const FName& PackageName, TArray<FName>& OutDependencies) const = 0;
+
+	/** Get the ancestors of a class, nearest first, without loading it */
+	virtual void GetAncestorClassPaths(const FTopLevelAssetPath& ClassPath, TArray<FTopLevelAssetPath>& OutAncestorClassPaths) const = 0;
+
+	/**
+	 * Get the file timestamp of every package stored on disk under a set of folders, recursively
+	 *
+	 * @return bool: false if the catalog's packages are not files, in which case nothing can be cached on disk
+	 */
+	virtual bool GetFolderPackageTimestamps(const TArray<FString>& FolderPaths, TMap<FName, FDateTime>& OutPackageTimestamps) const { return false; }
+
+	/** Get the file timestamps of individual packages; packages without a file are left out */
+	virtual void GetPackageTimestamps(const TArray<FName>& PackageNames, TMap<FName, FDateTime>& OutPackageTimestamps) const {}
+
+#pragma endregion
+
+#pragma region Operations
+
+	/**
+	 * Rename assets in one batch
+	 *
+	 * @param ObjectPathRenames: each asset's current object path paired with its new object path
+	 * @param OutRenamedObjectPaths: the old object path of every asset that was renamed
+	 */
+	virtual void RenameAssets(const TArray<TPair<FSoftObjectPath, FSoftObjectPath>>& ObjectPathRenames,
+		TArray<FSoftObjectPath>& OutRenamedObjectPaths) = 0;
+
+	/**
+	 * Delete assets
+	 *
+	 * @return int32: number of assets deleted
+	 */
+	virtual int32 DeleteAssets(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation) = 0;
+
+	/**
+	 * Duplicate assets
+	 *
+	 * @param SourcesAndNewPackageNames: each asset to copy paired with the package name of its copy
+	 * @return int32: number of copies created
+	 */
+	virtual int32 DuplicateAssets(const TArray<TPair<FAssetData, FString>>& SourcesAndNewPackageNames) = 0;
+
+	/** Point the referencers of redirectors at their targets and remove the redirectors */
+	virtual void FixupRedirectors(const TArray<FAssetData>& Redirectors) = 0;
+
+#pragma endregion
+
+#pragma region Events
+
+	/** Events broadcast for every asset change, including changes made through the catalog's own operations */
+	FOnCatalogAssetChanged& OnAssetAdded() { return AssetAddedEvent; }
+	FOnCatalogAssetChanged& OnAssetRemoved() { return AssetRemovedEvent; }
+	FOnCatalogAssetRenamed& OnAssetRenamed() { return AssetRenamedEvent; }
+	FOnCatalogAssetChanged& OnAssetUpdated() { return AssetUpdatedEvent; }
+
+protected:
+
+	FOnCatalogAssetChanged AssetAddedEvent;
+	FOnCatalogAssetChanged AssetRemovedEvent;
+	FOnCatalogAssetRenamed AssetRenamedEvent;
+	FOnCatalogAssetChanged AssetUpdatedEvent;
+
+#pragma endregion
+};
@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+
+/**
+ * Bulk action over a list of assets that runs a chunk at a time so the editor stays responsive
+ *
+ * @note: The owner calls ProcessNextChunk once per tick. A cancel takes effect between chunks, so every asset
+ *		  is either fully processed or untouched, and the processed assets are always a prefix of the list.
+ */
+class FAssetActionsJob
+{
+public:
+
+	/** 
+	 * Run the action on one chunk of assets; returns true if any asset was changed 
+	 * 
+	 * @note: Assets of a changed chunk that the action left untouched are added to the skipped assets
+	 */
+	using FProcessChunk = TFunction<bool(const TArray<TSharedPtr<FAssetData>>& Chunk, TArray<TSharedPtr<FAssetData>>& OutSkippedAssets)>;
+
+	FAssetActionsJob(const FString& InActionName, TArray<TSharedPtr<FAssetData>>&& InAssets, FProcessChunk&& InProcessChunk);
+
+	/**
+	 * Run the action on the next chunk of assets
+	 *
+	 * @return bool: returns true while assets remain and the job has not been cancelled
+	 */
+	bool ProcessNextChunk();
+
+	/** Stop the job before its next chunk; chunks already processed are kept */
+	void Cancel() { bCancelled = true; }
+
+	bool IsCancelled() const { return bCancelled; }
+	bool IsFinished() const { return bCancelled || NumProcessed == Assets.Num(); }
+
+	/** True if any processed chunk changed an asset */
+	bool HasChangedAssets() const { return bChangedAssets; }
+
+	/** Assets the action has run on so far */
+	TArrayView<const TSharedPtr<FAssetData>> GetProcessedAssets() const { return MakeArrayView(Assets.GetData(), NumProcessed); }
+
+	/** Assets of chunks that changed assets, less the assets those chunks skipped */
+	const TArray<TSharedPtr<FAssetData>>& GetChangedAssets() const { return ChangedAssets; }
+
+	/** Assets the action reached but left untouched, e.g. deletes blocked by a reference */
+	const TArray<TSharedPtr<FAssetData>>& GetSkippedAssets() const { return SkippedAssets; }
+
+	/** Fraction of assets processed, from 0 to 1 */
+	float GetProgressFraction() const;
+
+	/** Progress line for the tab: assets done, processing rate and estimated time left */
+	FText GetProgressText() const;
+
+	/** One line summary for the log once the job has finished */
+	FString GetSummary() const;
+
+private:
+
+	/** Action name shown in progress text, e.g. Adding prefixes */
+	FString ActionName;
+
+	TArray<TSharedPtr<FAssetData>> Assets;
+
+	FProcessChunk ProcessChunk;
+
+	int32 NumProcessed = 0;
+
+	TArray<TSharedPtr<FAssetData>> ChangedAssets;
+	TArray<TSharedPtr<FAssetData>> SkippedAssets;
+
+	bool bCancelled = false;
+	bool bChangedAssets = false;
+
+	/** Time the first chunk started; the rate is measured from here */
+	double StartTime = 0.0;
+
+	/** Seconds since the first chunk started */
+	double GetElapsedSeconds() const;
+};
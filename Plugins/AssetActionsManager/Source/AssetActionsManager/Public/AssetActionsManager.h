@@ -2,8 +2,65 @@
 
 #pragma once
 
+#include "AssetActionsCatalog.h"
+#include "AssetActionsReachability.h"
+#include "AssetActionsTable.h"
+#include "AssetNamingRules.h"
+#include "AssetRegistry/AssetData.h"
 #include "Modules/ModuleManager.h"
 
+/** 
+ * Asset changes reported by the manager so the widget can update its list without re-enumerating 
+ * 
+ * @note: Changes are collected from catalog events, which also fire for the manager's own bulk actions.
+ */
+struct FAssetActionsDelta
+{
+	/** Assets added to the project */
+	TArray<FAssetData> AddedAssets;
+
+	/** Object paths of assets removed from the project */
+	TArray<FSoftObjectPath> RemovedAssets;
+
+	/** Renamed assets paired with the object path they had before the rename */
+	TArray<TPair<FSoftObjectPath, FAssetData>> RenamedAssets;
+
+	/** Packages whose cached referencer count was invalidated */
+	TArray<FName> ReferencersChangedPackages;
+
+	/** 
+	 * True when the unused filter uses reachability and some packages may have become reachable or unreachable 
+	 * 
+	 * @note: The packages are taken from the manager with TakeReachabilityChanges once the delta is applied
+	 */
+	bool bReachabilityChanged = false;
+
+	/** 
+	 * True when settings a filter depends on were edited, so every filter result kept by the widget is stale 
+	 * 
+	 * @note: Set for naming rule and unused settings edits; no asset changed, so the other fields may be empty
+	 */
+	bool bFilterSettingsChanged = false;
+
+	bool IsEmpty() const
+	{
+		return AddedAssets.IsEmpty() && RemovedAssets.IsEmpty() && RenamedAssets.IsEmpty() && 
+			ReferencersChangedPackages.IsEmpty() && !bReachabilityChanged && !bFilterSettingsChanged;
+	}
+
+	void Append(const FAssetActionsDelta& Other)
+	{
+		AddedAssets.Append(Other.AddedAssets);
+		RemovedAssets.Append(Other.RemovedAssets);
+		RenamedAssets.Append(Other.RenamedAssets);
+		ReferencersChangedPackages.Append(Other.ReferencersChangedPackages);
+		bReachabilityChanged |= Other.bReachabilityChanged;
+		bFilterSettingsChanged |= Other.bFilterSettingsChanged;
+	}
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAssetActionsDataChanged, const FAssetActionsDelta&);
+
 class FAssetActionsManagerModule : public IModuleInterface
 {
 public:
@@ -12,37 +69,182 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
+#pragma region Catalog
+
+	/** 
+	 * Replace the catalog the manager enumerates and acts on 
+	 * 
+	 * @note: The registry catalog is installed on startup. Replacing it empties the asset table and drops every 
+	 *		  cached referencer, so it should not be called while the tab is open.
+	 */
+	void SetCatalog(const TSharedRef<IAssetActionsCatalog>& InCatalog);
+
+	/** Get the catalog the manager enumerates and acts on */
+	IAssetActionsCatalog& GetCatalog() const { return *Catalog; }
+
+	/** Check if the Quick Asset Actions tab is open, in which case the catalog must not be replaced */
+	bool IsAssetActionsTabOpen() const { return AssetActionsTab.IsValid(); }
+
+#pragma endregion
+
 #pragma region ProcessDataForWidget
 
 	/** Get an array of Asset Data under the folder that the user opened the right-click menu on */
-	TArray<TSharedPtr<FAssetData>> GetAllAssetDataUnderSelectedFolder();
+	TArray<FAssetData> GetAllAssetDataUnderSelectedFolder();
+
+	/** Enumerate the assets under the selected folders into the asset table */
+	void RefreshAssetTable();
+
+	/** Replace the selected folders and enumerate the assets under them; used when there is no content browser selection */
+	void RefreshAssetTableForFolders(const TArray<FString>& FolderPaths);
+
+	/** Get the folders the user opened the right-click menu on, or the ones last passed to RefreshAssetTableForFolders */
+	const TArray<FString>& GetSelectedFolderPaths() const { return SelectedFolderPaths; }
+
+	/** Replace the selected folders without enumerating them, e.g. to put back the selection after a test */
+	void SetSelectedFolderPaths(const TArray<FString>& FolderPaths) { SelectedFolderPaths = FolderPaths; }
+
+	/** 
+	 * Empty the asset table and start enumerating the selected folders into it a time slice at a time 
+	 * 
+	 * @note: Folders under the selection are gathered up front; each step then lists whole folders until its budget 
+	 *		  is spent. A synchronous refresh or a new catalog cancels the enumeration.
+	 */
+	void BeginAssetTableEnumeration();
+
+	/** 
+	 * List folders into the asset table until the time budget is spent 
+	 * 
+	 * @param OutAddedRows: rows added by this step
+	 * @return bool: true while folders remain to be listed
+	 */
+	bool StepAssetTableEnumeration(double BudgetSeconds, TArray<int32>& OutAddedRows);
+
+	/** Check if a time-sliced enumeration has folders left to list */
+	bool IsEnumeratingAssetTable() const { return NextEnumerationPath < EnumerationPaths.Num(); }
+
+	/** Get the per-frame budget for time-sliced listing and filtering from AssetActions.TimeSliceBudgetMs; 0 when off */
+	double GetTimeSliceBudgetSeconds() const;
+
+	/** 
+	 * Get the table of assets listed under the selected folders 
+	 * 
+	 * @note: The widget applies asset changes to this table and keeps its filter results and selection over its rows
+	 */
+	FAssetActionsTable& GetAssetTable() { return AssetTable; }
 	
-	/** Get count of all asset referencers for single asset */
+	/** 
+	 * Get count of all asset referencers for single asset 
+	 * 
+	 * @note: Counts are served from the referencer cache; the catalog is only queried
+	 *		  when the asset's package has not been cached yet or has been invalidated.
+	 */
 	int32 GetAssetReferencersCount(const TSharedPtr<FAssetData>& AssetData);
 
+	/** 
+	 * Query and cache referencer counts for every asset table row that is not already cached in one pass 
+	 * 
+	 * @note: Queries are split across worker threads; AssetActions.ParallelFilterChunkSize sets the rows per chunk.
+	 */
+	void CacheAssetReferencersCounts(const TBitArray<>& Rows);
+
+	/** Check if an asset should be listed for the given folders; redirectors and excluded folders are never listed */
+	bool IsAssetInFolders(const FAssetData& AssetData, const TArray<FString>& FolderPaths) const;
+
+	/** Event broadcast whenever assets are added, removed, renamed or their referencers change */
+	FOnAssetActionsDataChanged& OnAssetDataChanged() { return AssetDataChangedEvent; }
+
 	/** Move content browser location to asset path passed in by widget */
 	void SyncCBToClickedAsset(const FString& ClickedAssetPath);
 
-	/** Fix up redirectors to ensure asset file paths are accurate */
+	/** 
+	 * Fix up redirectors to ensure asset file paths are accurate 
+	 * 
+	 * @note: Scoped to the selected folders and the redirectors left behind by the plugin's own renames.
+	 *		  Returns immediately when nothing new was redirected since the last call.
+	 */
 	void FixUpRedirectors();
 
-	/** Get unused assets by filtering all assets */
-	TArray<TSharedPtr<FAssetData>> FilterForUnusedAssetData(const TArray<TSharedPtr<FAssetData>>& AssetDataToFilter);
+	/** 
+	 * Run a filter over asset table rows 
+	 * 
+	 * @note: Rows are evaluated in chunks on worker threads and merged in row order, so results never depend
+	 *		  on the number of threads.
+	 * @param RowsToFilter: bitset of the rows to evaluate
+	 * @return TBitArray: bitset sized to the asset table with a bit set for every evaluated row that passed
+	 */
+	TBitArray<> FilterAssetTable(EAssetActionsFilter Filter, const TBitArray<>& RowsToFilter);
+
+	/** 
+	 * Run a filter over a short list of asset table rows, such as the rows touched by an asset change 
+	 * 
+	 * @note: Rows are checked one by one on this thread and nothing is sized to the asset table
+	 * @return TBitArray: one bit per entry of RowsToFilter, set if that row passed
+	 */
+	TBitArray<> FilterAssetTableRows(EAssetActionsFilter Filter, const TArray<int32>& RowsToFilter);
+
+	/** 
+	 * Get unused assets by filtering asset table rows 
+	 * 
+	 * @note: Uses direct referencer counts or reachability from root assets, as set in UAssetActionsUnusedSettings
+	 */
+	TBitArray<> FilterForUnusedAssetData(const TBitArray<>& RowsToFilter);
 
-	/** Get assets with duplicate names by filtering all assets */
-	TArray<TSharedPtr<FAssetData>> FilterForDuplicateNameData(const TArray<TSharedPtr<FAssetData>>& AssetDataToFilter);
+	/** Get assets that can't be reached from any root asset by filtering asset table rows */
+	TBitArray<> FilterForUnreachableAssetData(const TBitArray<>& RowsToFilter);
 
-	/** Get assets with no prefix by filtering all assets */
-	TArray<TSharedPtr<FAssetData>> FilterForNoPrefixData(const TArray<TSharedPtr<FAssetData>>& AssetDataToFilter);
+	/** Check if the unused filter uses reachability, so a change to any asset can change the result for every row */
+	bool IsUnusedFilterReachabilityBased() const;
+
+	/** 
+	 * Get the packages that became reachable or unreachable since the last call 
+	 * 
+	 * @note: If a change removed a reference, reachability is rebuilt first and compared with the previous marks
+	 */
+	void TakeReachabilityChanges(TArray<FName>& OutChangedPackages);
+
+	/** Get assets with duplicate names by filtering asset table rows */
+	TBitArray<> FilterForDuplicateNameData(const TBitArray<>& RowsToFilter);
+
+	/** 
+	 * Group asset table rows that share an asset name 
+	 * 
+	 * @return TArray: one array of rows per duplicated name; names used by a single row are left out
+	 * @note: Matching is case-insensitive unless AssetActions.CaseSensitiveDuplicateNames is set
+	 */
+	TArray<TArray<int32>> GroupDuplicateNames(const TBitArray<>& Rows) const;
+
+	/** 
+	 * Compare two asset names in the order sets of duplicate names are listed 
+	 * 
+	 * @note: Alphabetical; names that only differ in casing are kept apart when matching is case-sensitive
+	 */
+	int32 CompareDuplicateNames(const FName& A, const FName& B) const;
+
+	/** Get assets whose names break the naming rules by filtering asset table rows */
+	TBitArray<> FilterForNamingViolations(const TBitArray<>& RowsToFilter);
+
+	/** Check the name of the asset in a table row against the naming rules for its class and folder */
+	EAssetNamingViolation GetNamingViolations(int32 Row);
 
 	/** Delete assets marked for deletion by the user widget
 	 *
 	 * @return bool: returns true when function successfully deletes an asset, else returns false
 	 *
+	 * @param bShowConfirmation: false when the user already confirmed, e.g. for each chunk of a bulk action
+	 * @param OutSkippedAssets: if set, receives the assets that still exist after the delete
 	 * @note: This is important because the widget calls different functions
 	 *		 based on whether or not assets were deleted.
 	 */
-	bool DeleteAssetsInList(const TArray<FAssetData>& AssetsToDelete);
+	bool DeleteAssetsInList(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation = true, TArray<FAssetData>* OutSkippedAssets = nullptr);
+
+	/**
+	 * Order assets so each one comes before the listed assets it references, for deleting in chunks without confirmation
+	 *
+	 * @return bool: returns false when a listed asset is referenced from outside the list or through a reference cycle;
+	 *				 a delete without confirmation would skip it, so the list must go through the engine's delete dialog
+	 */
+	bool OrderAssetsForChunkedDeletion(TArray<TSharedPtr<FAssetData>>& AssetsToDelete);
 
 	/** Rename assets selected in the user widget */
 	bool RenameAssetInList(const FString& NewName, const TSharedPtr<FAssetData>& AssetToRename);
@@ -97,60 +299,258 @@ private:
 
 #pragma endregion
 
-	TMap<FString, FString> PrefixesMap =
+#pragma region AssetEnumeration
+
+	/** Assets listed under the selected folders; filled when the tab is spawned or refreshed */
+	FAssetActionsTable AssetTable;
+
+	/** Folder names that contain required UE assets which should never be listed */
+	static constexpr const TCHAR* ExcludedFolderNames[] =
+	{
+		TEXT("Developers"),
+		TEXT("Collections"),
+		TEXT("__ExternalActors__"),
+		TEXT("__ExternalObjects__"),
+	};
+
+	/** 
+	 * Check if a package path is inside one of the excluded folders 
+	 * 
+	 * @param ExcludedPathsCache: results for package paths already checked during this enumeration
+	 */
+	bool IsExcludedPackagePath(const FName& PackagePath, TMap<FName, bool>& ExcludedPathsCache) const;
+
+	/** Check if a package path is one of the folder paths or a subfolder of one */
+	bool IsPackagePathInFolders(const FName& PackagePath, const TArray<FString>& FolderPaths) const;
+
+#pragma endregion
+
+#pragma region TimeSlicedEnumeration
+
+	/** Folders the running enumeration lists, each without its subfolders */
+	TArray<FName> EnumerationPaths;
+
+	/** Index of the next folder to list */
+	int32 NextEnumerationPath = 0;
+
+	/** Selected folders the running enumeration was started for */
+	TArray<FString> EnumerationFolderPaths;
+
+	/** Exclusion results per package path for the running enumeration */
+	TMap<FName, bool> EnumerationExcludedPaths;
+
+	/** Stop a running time-sliced enumeration; rows listed so far are kept */
+	void CancelAssetTableEnumeration();
+
+#pragma endregion
+
+#pragma region AuditCache
+
+	/** Folder paths the asset table was last filled for; the tab may already have moved on when the cache is saved */
+	TArray<FString> AssetTableFolderPaths;
+
+	/** 
+	 * Fill the asset table and referencer cache from the on-disk audit cache of the selected folders 
+	 * 
+	 * @return bool: false if the cache is disabled, missing or unusable with the current catalog
+	 * @note: Only the selected folders are walked on disk. Packages under them that are new or whose file changed
+	 *		  are queried from the catalog.
+	 */
+	bool LoadAssetTableFromAuditCache();
+
+	/** Write the asset table and the referencers cached for its packages to the on-disk audit cache */
+	void SaveAuditCache();
+
+	/** Delegate function that saves the audit cache when the tab closes */
+	void OnAssetActionsTabClosed(TSharedRef<SDockTab> ClosedTab);
+
+#pragma endregion
+
+#pragma region NameReservation
+
+	/** 
+	 * Collision-free asset names for one batch of new assets 
+	 * 
+	 * @note: Built once from the catalog; names handed out are reserved for the rest of the batch.
+	 */
+	struct FAssetNameReservations
 	{
-		{ TEXT("AimOffsetBlendSpace"), TEXT("AO_")},
-		{ TEXT("AnimBlueprint"), TEXT("ABP_") },
-		{ TEXT("AnimMontage"), TEXT("AM_") },
-		{ TEXT("AnimSequence"), TEXT("AS_") },
-		{ TEXT("BehaviorTree"), TEXT("BT_")},
-		{ TEXT("BlackboardData"), TEXT("BB_") },
-		{ TEXT("BlendSpace"), TEXT("BS_") },
-		{ TEXT("BlendSpace1D"), TEXT("BS_") },
-		{ TEXT("Blueprint"), TEXT("BP_")},
-		{ TEXT("ControlRigBlueprint"),TEXT("CRBP_") },
-		{ TEXT("CurveFloat"), TEXT("Curve_") },
-		{ TEXT("CurveLinearColor"), TEXT("Curve_") },
-		{ TEXT("CurveLinearColorAtlas"), TEXT("Curve_") },
-		{ TEXT("CurveVector"), TEXT("Curve_") },
-		{ TEXT("DataTable"),TEXT("DT_") },
-		{ TEXT("FoliageType_InstancedStaticMesh"), TEXT("FT_") },
-		{ TEXT("Font"), TEXT("Font_")},
-		{ TEXT("FontFace"), TEXT("Font_")},
-		{ TEXT("IKRetargeter"), TEXT("IK_") },
-		{ TEXT("IKRigDefinition"), TEXT("IK_") },
-		{ TEXT("LandscapeGrassType"), TEXT("LG_") },
-		{ TEXT("LandscapeLayerInfoObject"), TEXT("LL_") },
-		{ TEXT("LevelSequence"), TEXT("LS_") },
-		{ TEXT("MapBuildDataRegistry"), TEXT("MapBD_") },
-		{ TEXT("Material"), TEXT("M_") },
-		{ TEXT("MaterialFunction"), TEXT("MF_") },
-		{ TEXT("MaterialInstanceConstant"), TEXT("MI_") },
-		{ TEXT("MaterialParameterCollection"), TEXT("MPC_") },
-		{ TEXT("ParticleSystem"), TEXT("PS_") },
-		{ TEXT("PhysicalMaterial"), TEXT("PM_") },
-		{ TEXT("PhysicsAsset"), TEXT("PHYS_") },
-		{ TEXT("PoseAsset"), TEXT("POSE_") },
-		{ TEXT("ProceduralFoliageSpawner"), TEXT("FS_") },
-		{ TEXT("SkeletalMesh"), TEXT("SM_") },
-		{ TEXT("SkeletalMeshLODSettings"), TEXT("SK_") },
-		{ TEXT("SkeletalMeshLODSettings"), TEXT("SK_") },
-		{ TEXT("Skeleton"), TEXT("SKEL_") },
-		{ TEXT("SoundClass"), TEXT("SC_") },
-		{ TEXT("SoundCue"), TEXT("SFX_") },
-		{ TEXT("SoundMix"), TEXT("SMix_") },
-		{ TEXT("SoundWave"), TEXT("SFX_") },
-		{ TEXT("StaticMesh"), TEXT("SM_") },
-		{ TEXT("SubsurfaceProfile"), TEXT("SSP_") },
-		{ TEXT("Texture"), TEXT("T_")},
-		{ TEXT("Texture2D"), TEXT("T_")},
-		{ TEXT("TextureCube"), TEXT("TC_") },
-		{ TEXT("TextureRenderTarget"), TEXT("RT_") },
-		{ TEXT("TextureRenderTarget2D"), TEXT("RT_") },
-		{ TEXT("UserDefinedEnum"), TEXT("E_") },
-		{ TEXT("UserDefinedStruct"), TEXT("S_") },
-		{ TEXT("VectorFieldStatic"), TEXT("VF_") },
-		{ TEXT("WidgetBlueprint"), TEXT("WBP_") },
+		/** Package names that exist or were handed out in this batch */
+		TSet<FName> ReservedPackageNames;
+
+		/** Next number to try for each folder and base name */
+		TMap<FString, int32> NextSuffixByBaseName;
+
+		/** Return BaseName with the next number suffix that is free in the folder and reserve it */
+		FString Reserve(const FName& PackagePath, const FString& BaseName);
 	};
 
+	/** Gather the package names in the folders of the assets passed in */
+	FAssetNameReservations BuildNameReservations(const TArray<TSharedPtr<FAssetData>>& AssetsToName) const;
+
+#pragma endregion
+
+#pragma region BatchRename
+
+	/** 
+	 * Rename assets with a single catalog call, which saves the packages it changed together 
+	 * 
+	 * @param AssetsAndNewNames: each asset paired with its new name; assets stay in their folder
+	 * @return int32: number of assets renamed
+	 * @note: Assets whose new name is empty or unchanged are skipped.
+	 */
+	int32 RenameAssetsInBatch(const TArray<TPair<TSharedPtr<FAssetData>, FString>>& AssetsAndNewNames);
+
+#pragma endregion
+
+#pragma region Catalog
+
+	/** Source of assets and references, and target of every asset operation */
+	TSharedPtr<IAssetActionsCatalog> Catalog;
+
+#pragma endregion
+
+#pragma region NamingRules
+
+	/** Naming rules compiled from UAssetActionsNamingSettings */
+	FAssetNamingRules NamingRules;
+
+	/** True when the naming settings changed since the rules were last compiled */
+	bool bNamingRulesDirty = true;
+
+	/** Handle for the naming settings change event bound in StartupModule */
+	FDelegateHandle NamingSettingsChangedHandle;
+
+	/** Return the naming rules, compiling them first if the settings changed */
+	FAssetNamingRules& GetNamingRules();
+
+	/** Delegate function that marks the naming rules for recompiling and tells the widget to filter again */
+	void OnNamingSettingsChanged(UObject* Settings, struct FPropertyChangedEvent& PropertyChangedEvent);
+
+#pragma endregion
+
+#pragma region Reachability
+
+	/** Packages reachable from the roots in UAssetActionsUnusedSettings */
+	FAssetActionsReachability Reachability;
+
+	/** True when reachability has to be built from scratch, e.g. after the unused settings changed */
+	bool bReachabilityDirty = true;
+
+	/** True when an asset change removed a reached package or reference, so the marks are rebuilt and compared */
+	bool bReachabilityStale = false;
+
+	/** Packages that became reachable or unreachable and were not taken by the widget yet */
+	TSet<FName> ReachabilityChangedPackages;
+
+	/** Handle for the unused settings change event bound in StartupModule */
+	FDelegateHandle UnusedSettingsChangedHandle;
+
+	/** Return the reachable packages, gathering roots and marking again first if they are dirty or stale */
+	const FAssetActionsReachability& GetReachability();
+
+	/** 
+	 * Update reachability for a package that was removed 
+	 * 
+	 * @note: Only a reached package can change other marks, and then the marks go stale
+	 */
+	void UpdateReachabilityForRemovedPackage(const FName& PackageName, FAssetActionsDelta& OutDelta);
+
+	/** 
+	 * Update reachability for an asset that was added or saved 
+	 * 
+	 * @note: Only a reached package or a new root can change other marks. New references are marked in place;
+	 *		  a lost reference makes the marks stale.
+	 */
+	void UpdateReachabilityForChangedAsset(const FAssetData& AssetData, FAssetActionsDelta& OutDelta);
+
+	/** Check if asset changes can update the marks in place; otherwise they are rebuilt on next use anyway */
+	bool CanUpdateReachability();
+
+	/** Delegate function that marks reachability for rebuilding and tells the widget to filter again */
+	void OnUnusedSettingsChanged(UObject* Settings, struct FPropertyChangedEvent& PropertyChangedEvent);
+
+#pragma endregion
+
+#pragma region RedirectorTracking
+
+	/** Package names of assets renamed by the plugin that may have left a redirector behind */
+	TSet<FName> PendingRedirectorPackages;
+
+	/** Folder paths whose redirectors were fixed up by the last sweep */
+	TArray<FString> RedirectorSweptFolderPaths;
+
+	/** True when a redirector was added under the swept folders by anything other than the plugin */
+	bool bFolderRedirectorsDirty = true;
+
+#pragma endregion
+
+#pragma region ReferencerCache
+
+	/** 
+	 * Referencer package names for every package queried this session, keyed by package name 
+	 * 
+	 * @note: The widget row generator, the sorter and the unused filter all read from this cache.
+	 */
+	TMap<FName, TArray<FName>> CachedReferencers;
+
+	/** 
+	 * Reverse lookup from a referencer package to the cached packages that listed it 
+	 * 
+	 * @note: This allows a registry event on one package to invalidate exactly the entries it affects.
+	 */
+	TMultiMap<FName, FName> CachedPackagesByReferencer;
+
+	/** 
+	 * Packages whose cached referencers came from the audit cache and were not checked against the catalog yet 
+	 * 
+	 * @note: A package added outside the folders since the cache was written may reference any of them, so 
+	 *		  each list is replaced by one catalog query the first time it is read.
+	 */
+	TSet<FName> UnverifiedCachedReferencers;
+
+	/** Handles for the catalog events bound in SetCatalog */
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+
+	/** Event broadcast to listening widgets with the changes from each catalog event */
+	FOnAssetActionsDataChanged AssetDataChangedEvent;
+
+	/** Bind catalog events that keep the referencer cache up to date */
+	void BindCatalogEvents();
+
+	/** Remove catalog event bindings when the catalog is replaced or the module shuts down */
+	void UnbindCatalogEvents();
+
+	/** Return cached referencers for a package, querying the catalog on a cache miss */
+	const TArray<FName>& FindOrQueryReferencers(const FName& PackageName);
+
+	/** Cache the referencers queried for a package and record them in the reverse lookup */
+	const TArray<FName>& AddCachedReferencers(const FName& PackageName, TArray<FName>&& Referencers);
+
+	/** 
+	 * Drop the cached referencers of a single package and its reverse lookup entries 
+	 * 
+	 * @return bool: returns true if the package was cached
+	 */
+	bool RemoveCachedReferencers(const FName& PackageName);
+
+	/** 
+	 * Invalidate every cache entry whose count may have changed because PackageName changed 
+	 * 
+	 * @param OutInvalidatedPackages: packages whose cache entry was removed
+	 * @note: This is the package itself, the packages it used to reference and the packages it references now.
+	 */
+	void InvalidateReferencersForPackage(const FName& PackageName, TArray<FName>& OutInvalidatedPackages);
+
+	/** Delegate functions for catalog events */
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetUpdated(const FAssetData& AssetData);
+
+#pragma endregion
+
 };
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AssetActionsCatalog.h"
+#include "Containers/SparseArray.h"
+
+/**
+ * Catalog held entirely in memory, for running the manager against synthetic projects without loading any asset
+ *
+ * @note: There is one asset per package. Filling functions do not broadcast events, so a catalog holding millions
+ *		  of assets and references is filled first and then installed with FAssetActionsManagerModule::SetCatalog.
+ *		  Operations update the references in place and broadcast like the asset registry does. Renames fix up
+ *		  their referencers directly and leave no redirector behind.
+ */
+class FAssetActionsMemoryCatalog : public IAssetActionsCatalog
+{
+public:
+
+#pragma region Filling
+
+	/** Reserve room for a number of assets */
+	void Reserve(int32 NumAssets);
+
+	/**
+	 * Add an asset
+	 *
+	 * @return bool: false if an asset already exists in the package
+	 */
+	bool AddAsset(const FAssetData& AssetData);
+
+	/** Record that one package references another; both packages may be added before or after. Self references are ignored. */
+	void AddReference(const FName& ReferencerPackageName, const FName& DependencyPackageName);
+
+	/** Set the parent of a class so naming rules configured for the parent apply to it */
+	void SetParentClass(const FTopLevelAssetPath& ClassPath, const FTopLevelAssetPath& ParentClassPath);
+
+	/** Number of assets in the catalog */
+	int32 Num() const { return Assets.Num(); }
+
+#pragma endregion
+
+	/** IAssetActionsCatalog implementation */
+	virtual void GetAssets(const FARFilter& Filter, TArray<FAssetData>& OutAssets) const override;
+	virtual void GetSubPaths(const FName& PackagePath, TArray<FName>& OutSubPaths) const override;
+	virtual void GetReferencers(const FName& PackageName, TArray<FName>& OutReferencers) const override;
+	virtual void GetDependencies(const FName& PackageName, TArray<FName>& OutDependencies) const override;
+	virtual void GetAncestorClassPaths(const FTopLevelAssetPath& ClassPath, TArray<FTopLevelAssetPath>& OutAncestorClassPaths) const override;
+
+	virtual void RenameAssets(const TArray<TPair<FSoftObjectPath, FSoftObjectPath>>& ObjectPathRenames,
+		TArray<FSoftObjectPath>& OutRenamedObjectPaths) override;
+	virtual int32 DeleteAssets(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation) override;
+	virtual int32 DuplicateAssets(const TArray<TPair<FAssetData, FString>>& SourcesAndNewPackageNames) override;
+	virtual void FixupRedirectors(const TArray<FAssetData>& Redirectors) override;
+
+private:
+
+#pragma region Storage
+
+	/** Assets by index; removed assets leave a hole that later additions reuse */
+	TSparseArray<FAssetData> Assets;
+
+	/** Asset index of each package */
+	TMap<FName, int32> AssetIndexByPackageName;
+
+	/** Asset indices in each folder, not including subfolders */
+	TMap<FName, TArray<int32>> AssetIndicesByPackagePath;
+
+	/** 
+	 * Both directions of every package reference, so referencer and dependency queries are single lookups 
+	 * 
+	 * @note: Sets keep adding a reference constant time however many references a package already has.
+	 */
+	TMap<FName, TSet<FName>> DependenciesByPackage;
+	TMap<FName, TSet<FName>> ReferencersByPackage;
+
+	/** Parent of each class set with SetParentClass */
+	TMap<FTopLevelAssetPath, FTopLevelAssetPath> ParentClassPaths;
+
+	/** Check a folder against the filter's package paths */
+	bool IsPackagePathInFilter(const FName& PackagePath, const FARFilter& Filter) const;
+
+	/** Check an asset against the filter's package names and class paths */
+	bool IsAssetInFilter(const FAssetData& AssetData, const FARFilter& Filter) const;
+
+	/** Remove an asset and every reference to or from its package */
+	void RemoveAsset(int32 AssetIndex);
+
+	/** Move every reference to or from a package over to another package name */
+	void RenamePackageReferences(const FName& OldPackageName, const FName& NewPackageName);
+
+#pragma endregion
+};
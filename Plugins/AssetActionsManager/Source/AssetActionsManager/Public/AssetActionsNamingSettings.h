@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "AssetActionsNamingSettings.generated.h"
+
+/** Naming convention for assets of one class and its subclasses */
+USTRUCT()
+struct FAssetNamingClassRule
+{
+	GENERATED_BODY()
+
+	/** Short name of the asset class, e.g. StaticMesh; subclasses without a rule of their own use this one */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	FString ClassName;
+
+	/** Text the asset name must start with; leave empty for no prefix requirement */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	FString Prefix;
+
+	/** Text the asset name must end with; leave empty for no suffix requirement */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	FString Suffix;
+};
+
+/** Naming rules that apply under a content folder instead of the project rules */
+USTRUCT()
+struct FAssetNamingFolderOverride
+{
+	GENERATED_BODY()
+
+	/** Content folder the override applies to, including its subfolders, e.g. /Game/Characters */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	FString FolderPath;
+
+	/** Class rules that replace the project rule for the same class */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	TArray<FAssetNamingClassRule> ClassRules;
+
+	/** Text that may not appear in asset names under the folder, in addition to the project list */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	TArray<FString> ForbiddenSubstrings;
+};
+
+/**
+ * Project naming conventions checked by the naming filter and used when adding prefixes
+ *
+ * @note: Defaults live in the plugin's Config/DefaultAssetActionsManager.ini. Rules are compiled into
+ *		  FAssetNamingRules whenever they change; matching ignores case.
+ */
+UCLASS(config = AssetActionsManager, defaultconfig, meta = (DisplayName = "Quick Asset Actions Naming"))
+class ASSETACTIONSMANAGER_API UAssetActionsNamingSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Prefix and suffix rules by asset class */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	TArray<FAssetNamingClassRule> ClassRules;
+
+	/** Text that may not appear anywhere in an asset name */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	TArray<FString> ForbiddenSubstrings;
+
+	/**
+	 * Rules for specific content folders
+	 *
+	 * @note: When folders are nested, only the override for the deepest folder containing the asset applies.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Naming")
+	TArray<FAssetNamingFolderOverride> FolderOverrides;
+
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+};
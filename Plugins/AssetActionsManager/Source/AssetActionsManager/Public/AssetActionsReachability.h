@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IAssetActionsCatalog;
+class UAssetActionsUnusedSettings;
+
+/**
+ * Packages reachable through package references from a set of root packages
+ *
+ * @note: Marking is one breadth-first traversal. Each reached package is asked for its dependencies once and
+ *		  each reference is followed once, so the cost is linear in the reached part of the graph; packages
+ *		  that are never reached are never queried. The dependencies of reached packages are kept, so a change
+ *		  that only adds references is marked incrementally and only a lost reference needs a rebuild.
+ */
+class FAssetActionsReachability
+{
+public:
+
+	/**
+	 * Gather the root packages configured in the settings
+	 *
+	 * @note: Maps and root folders are found through the catalog; primary assets and always-cook lists come from
+	 *		  the Asset Manager and the packaging settings and may name packages the catalog does not have.
+	 */
+	static void GatherRootPackages(const IAssetActionsCatalog& Catalog, const UAssetActionsUnusedSettings& Settings, TArray<FName>& OutRootPackages);
+
+	/** Check if GatherRootPackages could return an asset's package, without gathering every root */
+	static bool IsRootAsset(const FAssetData& AssetData, const UAssetActionsUnusedSettings& Settings);
+
+	/**
+	 * Mark every package reachable from the roots, replacing the previous marks
+	 *
+	 * @param OutChangedPackages: if set, receives the packages whose mark differs from the previous build
+	 */
+	void Build(const IAssetActionsCatalog& Catalog, const TArray<FName>& RootPackages, TSet<FName>* OutChangedPackages = nullptr);
+
+	/**
+	 * Record the current dependencies of a package that is reached or has become a root, and mark what they reach
+	 *
+	 * @param OutNewlyReached: receives every package marked by this call
+	 */
+	void MarkFrom(const IAssetActionsCatalog& Catalog, const FName& PackageName, TArray<FName>&& Dependencies, TSet<FName>& OutNewlyReached);
+
+	/** Check if a reached package no longer references a package it referenced when it was marked */
+	bool LosesDependencies(const FName& PackageName, const TArray<FName>& Dependencies) const;
+
+	/** Drop every mark */
+	void Reset() { ReachablePackages.Reset(); DependenciesByPackage.Reset(); }
+
+	/** Check if a package was reached by the last build */
+	bool IsReachable(const FName& PackageName) const { return ReachablePackages.Contains(PackageName); }
+
+	/** Number of packages reached by the last build, roots included */
+	int32 Num() const { return ReachablePackages.Num(); }
+
+private:
+
+	/** Packages marked by the last build */
+	TSet<FName> ReachablePackages;
+
+	/** Dependencies of each reached package when it was marked */
+	TMap<FName, TArray<FName>> DependenciesByPackage;
+
+	/** Visit the queued packages and every unmarked package they reach, marking and queueing each one once */
+	void MarkQueued(const IAssetActionsCatalog& Catalog, TArray<FName>& PackagesToVisit, TSet<FName>* OutNewlyReached);
+};
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AssetActionsCatalog.h"
+
+/**
+ * Catalog over the project's content: queries go to the asset registry and operations to asset tools,
+ * object tools and the editor asset library
+ *
+ * @note: Registry events are forwarded to the catalog events for as long as the catalog exists.
+ */
+class FAssetActionsRegistryCatalog : public IAssetActionsCatalog
+{
+public:
+
+	FAssetActionsRegistryCatalog();
+	virtual ~FAssetActionsRegistryCatalog() override;
+
+	/** IAssetActionsCatalog implementation */
+	virtual void GetAssets(const FARFilter& Filter, TArray<FAssetData>& OutAssets) const override;
+	virtual void GetSubPaths(const FName& PackagePath, TArray<FName>& OutSubPaths) const override;
+	virtual void GetReferencers(const FName& PackageName, TArray<FName>& OutReferencers) const override;
+	virtual void GetDependencies(const FName& PackageName, TArray<FName>& OutDependencies) const override;
+	virtual void GetAncestorClassPaths(const FTopLevelAssetPath& ClassPath, TArray<FTopLevelAssetPath>& OutAncestorClassPaths) const override;
+	virtual bool GetFolderPackageTimestamps(const TArray<FString>& FolderPaths, TMap<FName, FDateTime>& OutPackageTimestamps) const override;
+	virtual void GetPackageTimestamps(const TArray<FName>& PackageNames, TMap<FName, FDateTime>& OutPackageTimestamps) const override;
+
+	virtual void RenameAssets(const TArray<TPair<FSoftObjectPath, FSoftObjectPath>>& ObjectPathRenames,
+		TArray<FSoftObjectPath>& OutRenamedObjectPaths) override;
+	virtual int32 DeleteAssets(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation) override;
+	virtual int32 DuplicateAssets(const TArray<TPair<FAssetData, FString>>& SourcesAndNewPackageNames) override;
+	virtual void FixupRedirectors(const TArray<FAssetData>& Redirectors) override;
+
+private:
+
+#pragma region RegistryEvents
+
+	/** Handles for the asset registry events forwarded to the catalog events */
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+
+	/** Helper function to get the asset registry; safe to call from any thread */
+	class IAssetRegistry& GetAssetRegistry() const;
+
+#pragma endregion
+
+#pragma region SaveStage
+
+	/**
+	 * Save the dirty packages of an operation in one stage, reporting the package count, total time and slowest package
+	 *
+	 * @note: File writes are asynchronous and may still be in flight when this returns; they are flushed at the
+	 *		  start of the next stage and when the catalog is destroyed.
+	 */
+	void SavePackagesInStage(const TArray<UPackage*>& PackagesToSave);
+
+#pragma endregion
+};
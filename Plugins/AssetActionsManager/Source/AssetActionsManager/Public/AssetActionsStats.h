@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stats and Insights instrumentation for the plugin
+ *
+ * @note: "stat AssetActions" shows the cycle counters and per-frame counts. An Insights capture with the cpu and
+ *		  counters channels shows the same scopes in the timeline and the counts as running totals.
+ */
+DECLARE_STATS_GROUP(TEXT("AssetActions"), STATGROUP_AssetActions, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Registry Queries"), STAT_AssetActions_RegistryQueries, STATGROUP_AssetActions, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rows Generated"), STAT_AssetActions_RowsGenerated, STATGROUP_AssetActions, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Assets Filtered"), STAT_AssetActions_AssetsFiltered, STATGROUP_AssetActions, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Packages Saved"), STAT_AssetActions_PackagesSaved, STATGROUP_AssetActions, );
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(AssetActions_RegistryQueries);
+TRACE_DECLARE_INT_COUNTER_EXTERN(AssetActions_RowsGenerated);
+TRACE_DECLARE_INT_COUNTER_EXTERN(AssetActions_AssetsFiltered);
+TRACE_DECLARE_INT_COUNTER_EXTERN(AssetActions_PackagesSaved);
+
+/**
+ * Time the enclosing scope in both a cycle counter and an Insights cpu scope
+ *
+ * @note: The cycle stat must be declared in the calling file as STAT_AssetActions_<Name> in STATGROUP_AssetActions.
+ */
+#define ASSET_ACTIONS_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_AssetActions_##Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(AssetActions_##Name)
+
+/**
+ * Add to one of the counters above, e.g. ASSET_ACTIONS_COUNT(RowsGenerated, 1)
+ *
+ * @note: Stats take counts from any thread. Trace counters are not atomic, so Insights only sees game thread counts.
+ */
+#define ASSET_ACTIONS_COUNT(Name, Amount) \
+	do \
+	{ \
+		INC_DWORD_STAT_BY(STAT_AssetActions_##Name, Amount); \
+		if (IsInGameThread()) { TRACE_COUNTER_ADD(AssetActions_##Name, Amount); } \
+	} \
+	while (0)
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Containers/BitArray.h"
+
+/** Filters that can be applied to the asset table */
+enum class EAssetActionsFilter : uint8
+{
+	All,
+	Unused,
+	DuplicateName,
+	NamingViolation,
+
+	Num
+};
+
+/**
+ * Structure-of-arrays table holding every asset listed under the selected folders
+ *
+ * @note: Each asset is stored once and identified by its row index. Filter results and selection are kept
+ *		  as bitsets over the rows instead of copied pointer arrays. Removed rows are tombstoned and reused
+ *		  by later additions, so the index of a live row never changes.
+ */
+class FAssetActionsTable
+{
+public:
+
+	/** Replace all rows with the assets passed in */
+	void Reset(TArray<FAssetData>&& AssetsData);
+
+	/** Add an asset to a free row and return the row index */
+	int32 AddRow(const FAssetData& AssetData);
+
+	/** Tombstone a row; the shared asset data is released once no row widget references it */
+	void RemoveRow(int32 Row);
+
+	/**
+	 * Update a row in place after a rename
+	 *
+	 * @note: The shared asset data is overwritten rather than replaced so row widgets bound to it stay current
+	 */
+	void UpdateRow(int32 Row, const FAssetData& AssetData);
+
+	/** Find the row of an asset by object path; returns INDEX_NONE when the asset is not listed */
+	int32 FindRow(const FSoftObjectPath& ObjectPath) const;
+
+	/** Find the row of a list item; returns INDEX_NONE when the item is not listed */
+	int32 FindRow(const TSharedPtr<FAssetData>& Item) const;
+
+	/** Add the rows of all listed assets in a package */
+	void FindRowsByPackageName(const FName& PackageName, TArray<int32>& OutRows) const;
+
+	/** Add the rows of all listed assets with an asset name */
+	void FindRowsByAssetName(const FName& AssetName, TArray<int32>& OutRows) const;
+
+	/** Get the number of listed assets with an asset name */
+	int32 NumRowsWithAssetName(const FName& AssetName) const;
+
+	/** Get the list items for all rows set in Rows */
+	void GetItems(const TBitArray<>& Rows, TArray<TSharedPtr<FAssetData>>& OutItems) const;
+
+	/** Resize a bitset over the rows so every row index is valid; new bits are cleared */
+	void PadRows(TBitArray<>& Rows) const;
+
+	bool IsValidRow(int32 Row) const { return LiveRows.IsValidIndex(Row) && LiveRows[Row]; }
+
+	/** Number of live rows */
+	int32 Num() const { return NumLiveRows; }
+
+	/** Number of allocated rows, including tombstones; row indices are always less than this */
+	int32 GetMaxRows() const { return Items.Num(); }
+
+	/** Bitset with a bit set for every live row */
+	const TBitArray<>& GetLiveRows() const { return LiveRows; }
+
+#pragma region Columns
+
+	const TSharedPtr<FAssetData>& GetItem(int32 Row) const { return Items[Row]; }
+	const FName& GetPackageName(int32 Row) const { return PackageNames[Row]; }
+	const FName& GetAssetName(int32 Row) const { return AssetNames[Row]; }
+	const FName& GetPackagePath(int32 Row) const { return PackagePaths[Row]; }
+	const FTopLevelAssetPath& GetAssetClassPath(int32 Row) const { return AssetClassPaths[Row]; }
+	FName GetAssetClassName(int32 Row) const { return AssetClassPaths[Row].GetAssetName(); }
+
+#pragma endregion
+
+private:
+
+	/** Shared asset data handed to the list view as its items; null for tombstoned rows */
+	TArray<TSharedPtr<FAssetData>> Items;
+
+	/** Columns copied out of the asset data so filters and sorting scan contiguous memory */
+	TArray<FName> PackageNames;
+	TArray<FName> AssetNames;
+	TArray<FName> PackagePaths;
+	TArray<FTopLevelAssetPath> AssetClassPaths;
+
+	/** Bit set for each live row */
+	TBitArray<> LiveRows;
+
+	/** Tombstoned rows available for reuse */
+	TArray<int32> FreeRows;
+
+	int32 NumLiveRows = 0;
+
+	/**
+	 * Lookup from a name to the rows that have it
+	 *
+	 * @note: Each row remembers its slot in the array for its name, so removing a row swaps the last row of that
+	 *		  name into the slot instead of searching the array. Thousands of rows sharing one name stay O(1) each.
+	 */
+	struct FRowsByName
+	{
+		TMap<FName, TArray<int32>> Rows;
+
+		/** Slot of each row in the array for its name, indexed by row */
+		TArray<int32> Slots;
+
+		void Reset(int32 NumRows);
+		void Add(const FName& Name, int32 Row);
+		void Remove(const FName& Name, int32 Row);
+		const TArray<int32>* Find(const FName& Name) const { return Rows.Find(Name); }
+	};
+
+	/** Lookups from package name, asset name and list item to rows */
+	FRowsByName RowsByPackageName;
+	FRowsByName RowsByAssetName;
+	TMap<const FAssetData*, int32> RowsByItem;
+
+	/** Copy the columns of an asset into a row and add it to the lookups */
+	void WriteRow(int32 Row, const FAssetData& AssetData);
+
+	/** Remove a row from the name lookups */
+	void RemoveRowFromNameLookups(int32 Row);
+};
@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "AssetActionsUnusedSettings.generated.h"
+
+/** How the unused filter decides that an asset is unused */
+UENUM()
+enum class EAssetActionsUnusedDetection : uint8
+{
+	/** Unused when no package references the asset's package; level maps are never listed */
+	DirectReferencers,
+
+	/** Unused when the asset's package can't be reached from any root through package references */
+	Reachability,
+};
+
+/**
+ * Settings for the unused filter
+ *
+ * @note: Reachability also finds groups of assets that only reference each other. Roots are gathered from the
+ *		  options below, and the graph is traversed once until a setting changes. Saved assets that only add
+ *		  references are marked in place; a lost reference or a deleted reached asset rebuilds the graph once.
+ */
+UCLASS(config = AssetActionsManager, defaultconfig, meta = (DisplayName = "Quick Asset Actions Unused Assets"))
+class ASSETACTIONSMANAGER_API UAssetActionsUnusedSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	/** How the unused filter decides that an asset is unused */
+	UPROPERTY(EditAnywhere, Config, Category = "Unused")
+	EAssetActionsUnusedDetection Detection = EAssetActionsUnusedDetection::DirectReferencers;
+
+	/** Every level map is a root */
+	UPROPERTY(EditAnywhere, Config, Category = "Roots", meta = (EditCondition = "Detection == EAssetActionsUnusedDetection::Reachability"))
+	bool bMapsAreRoots = true;
+
+	/** Every primary asset known to the Asset Manager is a root */
+	UPROPERTY(EditAnywhere, Config, Category = "Roots", meta = (EditCondition = "Detection == EAssetActionsUnusedDetection::Reachability"))
+	bool bPrimaryAssetsAreRoots = true;
+
+	/**
+	 * Everything the cook always includes is a root
+	 *
+	 * @note: This is the packaging settings' directories to always cook and maps to cook, and primary assets whose
+	 *		  Asset Manager rules are set to always cook.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Roots", meta = (EditCondition = "Detection == EAssetActionsUnusedDetection::Reachability"))
+	bool bAlwaysCookedAreRoots = true;
+
+	/** Content folders whose assets, including subfolders, are all roots */
+	UPROPERTY(EditAnywhere, Config, Category = "Roots", meta = (ContentDir, EditCondition = "Detection == EAssetActionsUnusedDetection::Reachability"))
+	TArray<FDirectoryPath> RootFolders;
+
+	/** Individual assets that are roots */
+	UPROPERTY(EditAnywhere, Config, Category = "Roots", meta = (EditCondition = "Detection == EAssetActionsUnusedDetection::Reachability"))
+	TArray<FSoftObjectPath> RootAssets;
+
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+};
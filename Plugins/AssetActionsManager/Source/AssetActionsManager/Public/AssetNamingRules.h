@@ -0,0 +1,155 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Containers/BitArray.h"
+
+class IAssetActionsCatalog;
+class UAssetActionsNamingSettings;
+struct FAssetNamingClassRule;
+
+/** Ways an asset name can break the naming rules */
+enum class EAssetNamingViolation : uint8
+{
+	None = 0,
+	MissingPrefix = 1 << 0,
+	MissingSuffix = 1 << 1,
+	ForbiddenSubstring = 1 << 2,
+};
+ENUM_CLASS_FLAGS(EAssetNamingViolation);
+
+/**
+ * Naming rules from UAssetActionsNamingSettings compiled for checking many asset names
+ *
+ * @note: Every prefix, suffix and forbidden substring is added once to a single Aho-Corasick automaton.
+ *		  Checking a name walks it one character at a time, and every rule that applies to the asset is
+ *		  decided in that one pass, however many rules there are. Matching ignores case.
+ */
+class FAssetNamingRules
+{
+public:
+
+	/** Rebuild the automaton and rule scopes from the settings and drop all cached class resolutions */
+	void Compile(const UAssetActionsNamingSettings& Settings);
+
+	/** Drop cached class resolutions; call when class hierarchies may have changed */
+	void ResetClassCache();
+
+	/** Set the catalog class ancestors are looked up in and drop cached class resolutions */
+	void SetCatalog(const IAssetActionsCatalog* InCatalog);
+
+	/** Check an asset name against every rule for its class and folder */
+	EAssetNamingViolation CheckName(const FName& AssetName, const FTopLevelAssetPath& ClassPath, const FName& PackagePath);
+
+	/**
+	 * Look up and cache the folder scope and class rule for an asset without checking its name
+	 *
+	 * @note: CheckName fills these caches as it goes, so it must not run on several threads at once. Resolving
+	 *		  every asset first on one thread lets CheckResolvedName run on any number of threads.
+	 */
+	void Resolve(const FTopLevelAssetPath& ClassPath, const FName& PackagePath);
+
+	/** Check an asset name against the rules resolved for it by Resolve; only reads, so it is safe to call concurrently */
+	EAssetNamingViolation CheckResolvedName(const FName& AssetName, const FTopLevelAssetPath& ClassPath, const FName& PackagePath) const;
+
+	/** Return the prefix required for an asset of a class in a folder, or nullptr if there is none */
+	const FString* FindPrefix(const FTopLevelAssetPath& ClassPath, const FName& PackagePath);
+
+private:
+
+#pragma region Automaton
+
+	/** Pattern text by pattern id, in the case it was configured with */
+	TArray<FString> Patterns;
+
+	/** Pattern ids by text; FString keys compare without case, matching the automaton */
+	TMap<FString, int32> PatternIds;
+
+	/** Goto function keyed by state in the high bits and lowercase character in the low bits */
+	TMap<uint64, int32> Transitions;
+
+	/** Character and child state of each edge out of a state; only used while building the failure links */
+	TArray<TArray<TPair<TCHAR, int32>>> Children;
+
+	/** State to fall back to when no transition exists, i.e. the longest proper suffix that is also a trie path */
+	TArray<int32> FailLinks;
+
+	/** Patterns ending at each state, including those reached through the failure links */
+	TArray<TArray<int32>> Outputs;
+
+	/** Return the id of a pattern, adding its path to the trie if it is new */
+	int32 AddPattern(const FString& Pattern);
+
+	/** Link every state to its failure state and merge outputs, breadth first from the root */
+	void BuildFailLinks();
+
+	/** Advance the automaton by one lowercase character */
+	int32 Step(int32 State, TCHAR Char) const;
+
+	static uint64 MakeTransitionKey(int32 State, TCHAR Char)
+	{
+		return (static_cast<uint64>(State) << 32) | static_cast<uint64>(Char);
+	}
+
+#pragma endregion
+
+#pragma region Scopes
+
+	/** Prefix and suffix pattern ids for one class; INDEX_NONE when there is no requirement */
+	struct FClassNamingRule
+	{
+		int32 PrefixPattern = INDEX_NONE;
+		int32 SuffixPattern = INDEX_NONE;
+	};
+
+	/**
+	 * Rules that apply in one part of the project
+	 *
+	 * @note: Scope 0 holds the project rules; each folder override adds a scope for its folder.
+	 */
+	struct FNamingScope
+	{
+		/** Content folder the scope applies to; empty for the project scope */
+		FString FolderPath;
+
+		/** Rules configured for the scope, by short class name */
+		TMap<FName, FClassNamingRule> ClassRules;
+
+		/** Bit set for every pattern that is forbidden in the scope */
+		TBitArray<> ForbiddenPatterns;
+
+		/** Rule resolved for each class path looked up in the scope, including inherited rules */
+		TMap<FTopLevelAssetPath, FClassNamingRule> ResolvedRules;
+	};
+
+	TArray<FNamingScope> Scopes;
+
+	/** Catalog providing class ancestors; without one only rules configured for the class itself apply */
+	const IAssetActionsCatalog* Catalog = nullptr;
+
+	/** Scope for each package path looked up so far */
+	TMap<FName, int32> ScopeByPackagePath;
+
+	/** Compile class rules and forbidden substrings into a scope */
+	void CompileScope(FNamingScope& Scope, const TArray<FAssetNamingClassRule>& ClassRules, const TArray<FString>& ForbiddenSubstrings);
+
+	/** Run a name through the automaton against one class rule and the forbidden patterns of a scope */
+	EAssetNamingViolation CheckNameInScope(const FName& AssetName, const FClassNamingRule& ClassRule, int32 ScopeIndex) const;
+
+	/** Return the scope of the deepest folder override that contains the package path */
+	int32 FindScope(const FName& PackagePath);
+
+	/**
+	 * Return the rule for a class in a scope
+	 *
+	 * @note: The class is checked first, then its ancestors nearest first. At each class a folder rule wins
+	 *		  over the project rule. Ancestors come from the catalog so no class is loaded.
+	 */
+	const FClassNamingRule& ResolveClassRule(const FTopLevelAssetPath& ClassPath, int32 ScopeIndex);
+
+	/** Find the rule configured for a class name in a scope or, failing that, the project scope */
+	const FClassNamingRule* FindConfiguredRule(const FName& ClassName, int32 ScopeIndex) const;
+
+#pragma endregion
+};
@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetNamingRules.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetActionsAuditCommandlet.generated.h"
+
+/**
+ * Runs the unused, duplicate name and naming rule audits from the Quick Asset Actions tab without any UI
+ * and writes the results as JSON and/or CSV
+ *
+ * @note: Usage: UnrealEditor-Cmd <Project> -run=AssetActionsAudit -nullrhi [-Paths=/Game/A+/Game/B]
+ *		  [-Output=<Dir>] [-Format=json|csv|both] [-MaxUnused=N] [-MaxDuplicateNames=N] [-MaxNamingViolations=N]
+ *
+ *		  Returns 0 when every count is within its threshold, 1 when a threshold is exceeded and 2 on bad
+ *		  arguments or a failed write. Thresholds that are not passed are not checked.
+ */
+UCLASS()
+class UAssetActionsAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UAssetActionsAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+
+	/** One asset flagged by an audit */
+	struct FAuditEntry
+	{
+		FString Audit;
+		int32 Row = INDEX_NONE;
+
+		/** Duplicate name group or naming violations; empty for unused assets */
+		FString Detail;
+	};
+
+	/** Write the entries and counts as a JSON report */
+	bool WriteJsonReport(const FString& Filename, const TArray<FAuditEntry>& Entries, const TMap<FString, int32>& Counts) const;
+
+	/** Write the entries as a CSV report with one line per flagged asset */
+	bool WriteCsvReport(const FString& Filename, const TArray<FAuditEntry>& Entries) const;
+
+	/** Describe naming violation flags for a report, e.g. MissingPrefix|ForbiddenSubstring */
+	static FString DescribeNamingViolations(EAssetNamingViolation Violations);
+};
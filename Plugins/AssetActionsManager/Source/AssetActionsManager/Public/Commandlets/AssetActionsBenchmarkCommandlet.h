@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetActionsBenchmarkCommandlet.generated.h"
+
+class FAssetActionsMemoryCatalog;
+class FJsonValue;
+
+/**
+ * Times the manager's enumeration and filter stages over synthetic in-memory catalogs of increasing size and
+ * writes the results as JSON so plugin versions can be compared
+ *
+ * @note: Usage: UnrealEditor-Cmd <Project> -run=AssetActionsBenchmark -nullrhi [-Sizes=1000+10000+100000]
+ *		  [-Iterations=5] [-Output=<Dir>] [-Paths=/Game]
+ *
+ *		  Each stage reports its first (cold) run, its best run, time per asset, allocator calls and the growth 
+ *		  of the best run against the previous size; a stage that scales linearly grows by about the size ratio. 
+ *		  When -Paths is passed the real enumeration of those folders is timed as well. Sorting and row 
+ *		  generation need Slate, which commandlets do not start, so they are timed by the 
+ *		  AssetActionsManager.Benchmark.Widget automation test with the same catalogs and report format.
+ */
+UCLASS()
+class UAssetActionsBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UAssetActionsBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+#pragma region Stages
+
+	/** Timing of one stage at one asset count */
+	struct FStageResult
+	{
+		FString Stage;
+		int32 NumAssets = 0;
+		double ColdMilliseconds = 0.0;
+		double BestMilliseconds = 0.0;
+
+		/** Growth in used physical memory over the cold run, in bytes */
+		int64 UsedPhysicalDelta = 0;
+
+		/** 
+		 * Allocator calls (malloc and realloc) made by all threads during the cold run 
+		 * 
+		 * @note: INDEX_NONE when the allocator in use does not count its calls
+		 */
+		int64 MallocCalls = INDEX_NONE;
+	};
+
+	/**
+	 * Generate a synthetic catalog with assets spread over folders and classes
+	 *
+	 * @note: About a tenth of the names are duplicated in another folder, a quarter have no prefix and a third
+	 *		  of the assets have no referencer, so every filter has work to do. The catalog is deterministic for
+	 *		  a given size.
+	 */
+	static TSharedRef<FAssetActionsMemoryCatalog> GenerateCatalog(int32 NumAssets);
+
+	/**
+	 * Run a stage Iterations times and record its cold and best timings
+	 *
+	 * @param Setup: untimed work run before each iteration, e.g. copying the assets a stage consumes
+	 */
+	static FStageResult RunStage(const FString& Stage, int32 NumAssets, int32 Iterations,
+		TFunctionRef<void()> Setup, TFunctionRef<void()> StageBody);
+
+	/** Add a stage result to the report and log it next to the result for the previous size */
+	static void ReportStage(const FStageResult& Result, const FStageResult* PreviousResult, TArray<TSharedPtr<FJsonValue>>& OutReportValues);
+
+	/**
+	 * Write the stage results as a JSON report named after the suite and the current time
+	 *
+	 * @return bool: false if the report could not be written
+	 */
+	static bool WriteReport(const FString& Suite, const TArray<TSharedPtr<FJsonValue>>& ReportValues, int32 Iterations, const FString& OutputDir);
+
+	/** Default folder the reports are written to */
+	static FString GetDefaultOutputDir();
+
+#pragma endregion
+
+private:
+
+	/** Check if the allocator counts its calls, by making one allocation and watching the counter */
+	static bool IsCountingMallocCalls();
+
+	/** Get the number of allocator calls made so far by all threads */
+	static uint64 GetMallocCalls();
+};
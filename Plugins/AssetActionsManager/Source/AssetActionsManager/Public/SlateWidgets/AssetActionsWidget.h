@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "AssetActionsJob.h"
+#include "AssetActionsManager.h"
 #include "Widgets/Input/SNumericEntryBox.h"
 #include "Widgets/Text/SRichTextBlock.h"
 #include "Widgets/SCompoundWidget.h"
@@ -20,16 +22,12 @@ class SAssetActionsTab : public SCompoundWidget
 {
 	SLATE_BEGIN_ARGS(SAssetActionsTab) {}
 
-		/**
-		 * Argument used to pass asset data between manager and widget
+		/** 
+		 * Argument for the folder path(s) that user selected when spawning tab 
 		 * 
-		 * @note: AllAssetsDataFromManager: Array of asset data from the manager
+		 * @note: The assets found in these folders are read from the manager's asset table.
 		 * This argument name matches the FArg in the OnSpawn fn in AssetActionsManager.
-		 * The type must match what the ListItemSource fn in ConstructAssetListView expects.
 		 */
-		SLATE_ARGUMENT(TArray<TSharedPtr<FAssetData>>, AllAssetsDataFromManager) 
-
-		/** Argument for the folder path(s) that user selected when spawning tab */
 		SLATE_ARGUMENT(TArray<FString>, SelectedFoldersPaths)
 
 	SLATE_END_ARGS()
@@ -43,6 +41,23 @@ public:
 	 */
 	void Construct(const FArguments& InArgs);
 
+	/** Stop listening to asset changes from the manager */
+	virtual ~SAssetActionsTab();
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/** Get the asset list view so automation tests can scroll it and count its row widgets */
+	TSharedPtr<SListView<TSharedPtr<FAssetData>>> GetAssetListViewForTesting() const { return ConstructedAssetListView; }
+
+	/** Get the list view items in display order so automation tests can look up the row widgets in view */
+	const TArray<TSharedPtr<FAssetData>>& GetDisplayedAssetsForTesting() const { return DisplayedAssetsData; }
+
+	/** Sort by a column as if its header was clicked, so automation tests can time sorting */
+	void SortByColumnForTesting(const FName& ColumnId, EColumnSortMode::Type InSortMode) 
+	{ 
+		OnSortModeChanged(EColumnSortPriority::Primary, ColumnId, InSortMode); 
+	}
+#endif
+
 private:
 
 #pragma region TitleSlot
@@ -80,7 +95,7 @@ private:
 	TSharedRef<SWidget> OnGenerateFilterItem(TSharedPtr<FString> FilterItem);
 
 	/** Delegate function to apply filter criteria based on user selection */
-	void OnFilterSelectionChanged(TSharedPtr<FString> SelectedFilter, ESelectInfo::Type InSelectInfo);
+	void OnFilterSelectionChanged(TSharedPtr<FString> SelectedFilterItem, ESelectInfo::Type InSelectInfo);
 	
 	/** Construct Refresh Button that allows a user to manually refresh the asset list view */
 	TSharedRef<SButton> ConstructRefreshButton();
@@ -107,6 +122,49 @@ private:
 	/** Currently selected sorting mode; default = Ascending */
 	EColumnSortMode::Type SortMode;
 
+	/** Column used to break ties in the primary column; set by shift-clicking a header */
+	FName SecondarySortByColumn;
+
+	/** Sorting mode of the secondary column */
+	EColumnSortMode::Type SecondarySortMode;
+
+	/** 
+	 * Compact sort key for a listed asset 
+	 * 
+	 * @note: Class, name and path are stored as ranks among all distinct values so sorting never touches strings
+	 */
+	struct FAssetSortKey
+	{
+		uint32 ClassRank = 0;
+		uint32 NameRank = 0;
+		uint32 PathRank = 0;
+		uint32 RefCount = 0;
+	};
+
+	/** Sort keys for all listed assets, indexed by asset table row */
+	TArray<FAssetSortKey> SortKeys;
+
+	/** 
+	 * Distinct values of a sort column in compare order and the rank given to each 
+	 * 
+	 * @note: Ranks are spread over the whole uint32 range, so a value added later can take a rank between its
+	 *		  neighbours without renumbering the others
+	 */
+	struct FColumnRanks
+	{
+		TArray<FName> SortedValues;
+		TMap<FName, uint32> Ranks;
+	};
+
+	/** Ranks the sort keys were built from, kept so the keys of changed rows can be patched */
+	FColumnRanks ClassRanks;
+	FColumnRanks NameRanks;
+	FColumnRanks PathRanks;
+
+	/** Asset data generation the sort keys and their referencer counts were built for */
+	uint32 SortKeysGeneration = MAX_uint32;
+	uint32 RefCountKeysGeneration = MAX_uint32;
+
 	/** Construct SListView to display all assets in selected folder */
 	TSharedRef<SListView<TSharedPtr<FAssetData>>> ConstructAssetListView();
 
@@ -119,7 +177,10 @@ private:
 	/** Construct a checkbox for header row that toggles between select all and deselect all */
 	TSharedRef<SCheckBox> ConstructCheckBoxForHeaderRow();
 
-	/** Delegate function that keeps track of checked and unchecked state of each row */
+	/** Delegate function that binds the header checkbox to the checked state of the displayed assets */
+	ECheckBoxState GetHeaderCheckBoxState() const;
+
+	/** Delegate function that selects or deselects all displayed assets */
 	void OnHeaderCheckBoxStateChanged(ECheckBoxState CheckBoxState);
 
 	/** 
@@ -129,10 +190,56 @@ private:
 	 */
 	EColumnSortMode::Type GetSortModeForColumn(const FName ColumnId) const;
 
+	/** Delegate function to get sort priority for each column */
+	EColumnSortPriority::Type GetSortPriorityForColumn(const FName ColumnId) const;
+
 	/** Delegate function to apply new sort criteria when changed by user */
 	void OnSortModeChanged(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode);
 
-	/** Function that contains sorting logic for every sortable column */
+	/** Get the secondary sort column, including the implicit tie breakers for the name and checkbox columns */
+	void GetEffectiveSecondarySort(FName& OutColumnId, EColumnSortMode::Type& OutSortMode) const;
+
+	/** Compare two assets by a single column in ascending order */
+	int32 CompareAssetsForColumn(const FName& ColumnId, const TSharedPtr<FAssetData>& A, const TSharedPtr<FAssetData>& B) const;
+
+	/** Build sort keys for all listed assets if they are older than the current asset data generation */
+	void BuildSortKeys(bool bIncludeRefCounts);
+
+	/** 
+	 * Update the sort keys of rows added or renamed since the keys were built 
+	 * 
+	 * @return bool: false if a new value found no free rank between its neighbours; the keys must then be rebuilt
+	 */
+	bool PatchSortKeys(const TArray<int32>& Rows);
+
+	/** Get the rank of a column value, giving a value that was not ranked yet the rank halfway between its neighbours */
+	static bool FindOrAddRank(FColumnRanks& ColumnRanks, const FName& Value, uint32& OutRank);
+
+	/** 
+	 * Get the rank of every set of duplicate names among the displayed rows, indexed by asset table row 
+	 * 
+	 * @note: Used as the primary sort key while duplicate names are listed so each set is shown together
+	 */
+	void BuildDuplicateGroupRanks(const TArray<int32>& DisplayedRows, TArray<uint32>& OutGroupRanks);
+
+	/** Get the rank of a sort key for a single column */
+	static uint32 GetColumnRank(const FName& ColumnId, const FAssetSortKey& SortKey, bool bChecked);
+
+	/** Predicate type used to order the displayed asset data */
+	using FAssetSortPredicate = TFunction<bool(const TSharedPtr<FAssetData>&, const TSharedPtr<FAssetData>&)>;
+
+	/** 
+	 * Build the comparison for the current sort column and sort mode 
+	 * 
+	 * @note: Shared by full sorts and by sorted insertion of assets added or renamed while the tab is open
+	 */
+	FAssetSortPredicate GetSortPredicate() const;
+
+	/** 
+	 * Function that contains sorting logic for every sortable column 
+	 * 
+	 * @note: Does nothing while a time-sliced load is filling the list; the load sorts once when it finishes
+	 */
 	void UpdateSorting();
 	
 	/** Function sets the sort criteria when widget is first spawned */
@@ -143,48 +250,84 @@ private:
 #pragma region RowsInListView
 
 	/** 
-	 * Array to hold all asset data passed in by the AssetActionsManager
+	 * Array to hold all asset data displayed in the list view
 	 * 
-	 * @note: This is assigned to the InArgs of the Construct fn.
+	 * @note: This is passed in as the list item source. It is the only array of list items kept by the widget;
+	 *		  all other asset sets are bitsets over the rows of the manager's asset table.
 	 */
-	TArray<TSharedPtr<FAssetData>> AllAssetsDataFromManager;
+	TArray<TSharedPtr<FAssetData>> DisplayedAssetsData;
 
 	/** 
-	 * Array to hold all asset data displayed in the list view
+	 * Index in DisplayedAssetsData for every asset table row; INDEX_NONE if the row is not displayed 
 	 * 
-	 * @note: This is passed in as the list item source
+	 * @note: Rebuilt by every full sort and kept up to date by ApplyAssetChanges, so asset changes find the
+	 *		  list items to take out without searching the list. Other changes to the displayed assets 
+	 *		  always end in a full sort.
 	 */
-	TArray<TSharedPtr<FAssetData>> DisplayedAssetsData;
+	TArray<int32> DisplayedIndexByRow;
+
+	/** Get the index of a row in DisplayedAssetsData; INDEX_NONE if the row is not displayed */
+	int32 GetDisplayedIndex(int32 Row) const;
 
-	/** Array to hold unused assets filtered by manager */
-	TArray<TSharedPtr<FAssetData>> UnusedAssetsData;
+	/** 
+	 * Take list items out of DisplayedAssetsData and insert rows at their sorted positions 
+	 * 
+	 * @note: The list view needs one contiguous array, so only the items after the first change are moved, 
+	 *		  once per pass, instead of once per changed asset
+	 */
+	void PatchDisplayedAssets(TArray<int32>& DisplayedIndicesToRemove, TArray<int32>& RowsToInsert);
 
-	/** Array to hold assets with duplicate names filtered by manager */
-	TArray<TSharedPtr<FAssetData>> DuplicatedNameAssetsData;
+	/** Memoized result of a manager filter fn */
+	struct FFilterResult
+	{
+		/** Bit set for every asset table row that passed the filter */
+		TBitArray<> Rows;
 
-	/** Array to hold assets with no prefix (or incorrect prefix) filtered by manager */
-	TArray<TSharedPtr<FAssetData>> NoPrefixAssetsData;
+		/** Value of AssetDataGeneration when the result was computed; MAX_uint32 if never computed */
+		uint32 Generation = MAX_uint32;
+	};
 
 	/** 
-	 * Array to hold all constructed CheckBoxes when widget is constructed
+	 * Filter results indexed by EAssetActionsFilter (unused, duplicate name and no prefix) 
 	 * 
-	 * @note: The size of this array is dependent on the number of assets in the selected folder
-	 * and subfolders. Array is important for select and deselect fns.
+	 * @note: Filters are only evaluated when their view is selected
 	 */
-	TArray<TSharedRef<SCheckBox>> CheckBoxesArray;
+	FFilterResult FilterResults[static_cast<int32>(EAssetActionsFilter::Num)];
+
+	/** 
+	 * Counter bumped whenever the listed assets or their references change 
+	 * 
+	 * @note: A filter result is reused as long as its generation matches this counter
+	 */
+	uint32 AssetDataGeneration = 0;
+
+	/** Filter currently selected in the ComboBox */
+	EAssetActionsFilter SelectedFilter = EAssetActionsFilter::All;
+
+	/** 
+	 * Bit set for every asset table row that is checked in the asset list view 
+	 * 
+	 * @note: Rows keep their index while the asset is listed, so the row is the asset's selection key.
+	 *		  Row checkboxes bind their checked state to this bitset instead of being tracked by the widget.
+	 */
+	TBitArray<> CheckedRows;
+
+	/** Number of bits set in CheckedRows; kept up to date on every change so the header state is O(1) */
+	int32 NumCheckedRows = 0;
 
-	/** Array to hold all assets that are checked in the asset list view. */
-	TArray<TSharedPtr<FAssetData>> CheckedAssets;
+	/** Number of displayed assets that are checked; the header checkbox state is derived from this */
+	int32 NumCheckedDisplayedAssets = 0;
 
-	/** Array to hold all assets that are not checked in the asset list view. */
-	TArray<TSharedPtr<FAssetData>> UncheckedAssets;
+	/** Last row checkbox clicked; shift-clicking another row checks or unchecks every row in between */
+	TSharedPtr<FAssetData> SelectionAnchor;
 
 	/** 
-	 * Generate a row in the list view for every asset found in the selected folders
+	 * Generate a row in the list view for an asset scrolled into view
 	 * 
 	 * @param AssetDataToDisplay: AssetData specific to each row
 	 * @note: AssetDataToDisplay is used to determine the clicked asset data when user 
-	 *		  clicks on a specific row
+	 *		  clicks on a specific row. Rows hold no state of their own; everything is bound to the
+	 *		  asset data and checked rows, so the list view can release and regenerate them freely.
 	 */
 	TSharedRef<ITableRow> OnGenerateRowForListView(TSharedPtr<FAssetData> AssetDataToDisplay, 
 		const TSharedRef<STableViewBase>& OwnerTable);
@@ -192,11 +335,18 @@ private:
 	/** Construct a checkbox for each row in the list view */
 	TSharedRef<SCheckBox> ConstructCheckBoxes(const TSharedPtr<FAssetData>& AssetDataToDisplay);
 
+	/** Delegate function that binds the checked state of each row to the checked rows */
+	ECheckBoxState GetCheckBoxState(TSharedPtr<FAssetData> AssetData) const;
+
 	/** Delegate function that keeps track of checked and unchecked state of each row */
 	void OnCheckBoxStateChanged(ECheckBoxState CheckBoxState, TSharedPtr<FAssetData> ClickedAssetData);
 	
-	/** Construct text for each row to display asset properties such as class, name, and path */
-	TSharedRef<STextBlock> ConstructTextForRow(const FString& RowText);
+	/** 
+	 * Construct text for each row to display asset properties such as class, name, and path 
+	 * 
+	 * @note: Text is an attribute so rows reused after a rename show the new values
+	 */
+	TSharedRef<STextBlock> ConstructTextForRow(const TAttribute<FText>& RowText);
 
 	/** Construct a rename button for each row in the list view */
 	TSharedRef<SButton> ConstructRenameButtonForRow(const TSharedPtr<FAssetData>& AssetDataToDisplay);
@@ -237,6 +387,80 @@ private:
 
 #pragma endregion
 
+#pragma region BulkActionJob
+
+	/** Bulk action currently running a chunk per tick; null when no action is running */
+	TSharedPtr<FAssetActionsJob> ActiveJob;
+
+	/** True if redirectors should be fixed up once the active job finishes */
+	bool bFixUpRedirectorsAfterJob = false;
+
+	/** 
+	 * Start running a bulk action in chunks and show its progress 
+	 * 
+	 * @note: Changed rows are updated through the asset changes reported by the manager as each chunk completes.
+	 */
+	void StartBulkActionJob(const TSharedRef<FAssetActionsJob>& Job, bool bFixUpRedirectors);
+
+	/** Active timer that runs one chunk of the active job per tick */
+	EActiveTimerReturnType TickBulkActionJob(double InCurrentTime, float InDeltaTime);
+
+	/** Uncheck the processed assets, fix up redirectors if needed and release the job */
+	void FinishBulkActionJob();
+
+	/** Construct the progress bar, progress text and cancel button shown while a bulk action runs */
+	TSharedRef<SWidget> ConstructJobProgress();
+
+	/** Delegate function that cancels the active job after its current chunk */
+	FReply OnCancelJobButtonClicked();
+
+	/** Delegate functions that bind the progress widgets to the active job */
+	EVisibility GetJobProgressVisibility() const;
+	TOptional<float> GetJobProgressPercent() const;
+	FText GetJobProgressText() const;
+
+	/** Bulk action buttons are disabled while a job runs or the list is still loading */
+	bool IsBulkActionIdle() const { return !ActiveJob.IsValid() && !bTimeSlicedLoadActive; }
+
+#pragma endregion
+
+#pragma region TimeSlicedLoad
+
+	/** True while the list is filled a time slice per frame */
+	bool bTimeSlicedLoadActive = false;
+
+	/** Rows the selected filter still evaluates once every folder is listed, in row order */
+	TArray<int32> RowsToEvaluate;
+
+	/** Number of RowsToEvaluate already evaluated */
+	int32 NumRowsEvaluated = 0;
+
+	/** Rows evaluated per filter call; the budget is checked between calls */
+	static constexpr int32 TimeSlicedFilterBlockSize = 4096;
+
+	/** Assets checked before a time-sliced refresh, checked again as their rows are listed */
+	TSet<FSoftObjectPath> CheckedAssetPathsToRestore;
+
+	/** 
+	 * Fill the list a time slice per frame: first the rows listed by the manager's enumeration, then the rows 
+	 * that pass the selected filter
+	 * 
+	 * @note: Rows are shown as they are found and sorted once the load finishes. Asset changes received meanwhile
+	 *		  are applied after the load, and bulk actions are disabled until then.
+	 */
+	void StartTimeSlicedLoad();
+
+	/** Queue every listed row for the selected filter, or show its memoized result if it is current */
+	void BeginTimeSlicedFilter();
+
+	/** Active timer that runs one time slice of the load */
+	EActiveTimerReturnType TickTimeSlicedLoad(double InCurrentTime, float InDeltaTime);
+
+	/** Sort the filled list in one frame and apply the asset changes received during the load */
+	void FinishTimeSlicedLoad();
+
+#pragma endregion
+
 #pragma region HelpfulInfoSlot
 
 	/** 
@@ -272,27 +496,93 @@ private:
 	/** Refresh widget to ensure text and list view are always up to date */
 	void RefreshWidget();
 
-	/** Helper function to filter asset data found under the selected folder  */
-	void FilterAssetData();
+	/** Helper function to re-sort and refresh the list view without re-enumerating assets */
+	void RefreshListView();
+
+	/** Helper function to update the asset count text for the displayed assets */
+	void RefreshAssetCountText();
+
+	/** Helper function to get filtered asset table rows, running the manager filter fn only if the memoized result is stale */
+	const TBitArray<>& GetFilteredRows(EAssetActionsFilter Filter);
+
+	/** Helper function to set the displayed assets to the rows that pass the selected filter */
+	void DisplayFilteredAssets();
+
+	/** Helper function to check if a filter result matches the current asset data generation */
+	bool IsFilterResultCurrent(EAssetActionsFilter Filter) const;
+
+	/** Helper function to uncheck all assets after a bulk action */
+	void ClearCheckedAssets();
+
+	/** Helper functions to query and change the checked state of a listed asset */
+	bool IsAssetChecked(const TSharedPtr<FAssetData>& AssetData) const;
+
+	/** @return bool: returns true if the checked state of the asset changed */
+	bool SetAssetChecked(const TSharedPtr<FAssetData>& AssetData, bool bChecked);
+
+	/** 
+	 * Bulk selection: check or uncheck a set of asset table rows, all displayed assets, or a range of displayed assets
+	 * 
+	 * @note: Each call is one pass over the checked rows followed by a single header update and list invalidation
+	 */
+	void SetRowsChecked(const TBitArray<>& Rows, bool bChecked);
+	void SetDisplayedAssetsChecked(bool bChecked);
+	void SetDisplayedRangeChecked(int32 FirstIndex, int32 LastIndex, bool bChecked);
 
-	/** Helper function to remove asset data from arrays when deleted */
-	void EnsureAssetDeletionFromLists(const TSharedPtr<FAssetData>& AssetDataToDelete);
+	/** Helper function to update the header and visible rows after the checked rows changed in bulk */
+	void OnCheckedRowsChanged();
 
-	/** Helper function to get map of asset names and paths */
-	TMultiMap<FString, FString> GetCheckBoxAssetMap(const TArray<TSharedPtr<FAssetData>> CheckBoxStateArray);
+	/** Helper function to gather the checked assets for a bulk action */
+	TArray<TSharedPtr<FAssetData>> GetCheckedAssets() const;
 
-	/** Helper function to ensure header checkbox state matches row checkbox states */
+	/** Helper function to clear the checked state and memoized filter bits of a row removed from the asset table */
+	void ClearRowState(int32 Row);
+
+	/** Helper function to recount the checked displayed assets so the header checkbox state matches the rows */
 	void TrackCheckBoxStateForHeader();
 
 	/** Helper function to load asset action manager module */
 	class FAssetActionsManagerModule& LoadManagerModule() const 
 	{ return FModuleManager::LoadModuleChecked<FAssetActionsManagerModule>(TEXT("AssetActionsManager")); }
 
+	/** Helper function to get the manager's asset table */
+	FAssetActionsTable& GetAssetTable() const { return LoadManagerModule().GetAssetTable(); }
+
 	/** Helper function to get UE Embossed font style */
 	FSlateFontInfo GetEmbossedFont() const { return FCoreStyle::Get().GetFontStyle(FName("EmbossedText")); }
 
 	/** Helper function to get asset count message since it is dynamically reassigned based on displayed assets */
-	FString GetAssetCountMsg() const { return FString::FromInt(DisplayedAssetsData.Num()) + TEXT(" assets"); }
+	FString GetAssetCountMsg() const 
+	{ 
+		return FString::FromInt(DisplayedAssetsData.Num()) + (bTimeSlicedLoadActive ? TEXT(" assets so far...") : TEXT(" assets")); 
+	}
+
+#pragma endregion
+
+#pragma region AssetChanges
+
+	/** Handle for the manager's asset change event */
+	FDelegateHandle AssetDataChangedHandle;
+
+	/** Asset changes received since the list was last updated */
+	FAssetActionsDelta PendingAssetChanges;
+
+	/** True while an active timer is registered to apply pending asset changes */
+	bool bAssetChangesScheduled = false;
+
+	/** Delegate function that collects asset changes from the manager until the next Slate tick */
+	void OnAssetDataChanged(const FAssetActionsDelta& Delta);
+
+	/** Active timer that applies all asset changes collected during the last frame at once */
+	EActiveTimerReturnType ApplyPendingAssetChanges(double InCurrentTime, float InDeltaTime);
+
+	/** 
+	 * Apply added, removed and renamed assets to the asset table and the displayed list 
+	 * 
+	 * @note: Only changed assets are filtered again and surviving rows keep their widgets,
+	 *		  so the cost is proportional to the number of changed assets.
+	 */
+	void ApplyAssetChanges(const FAssetActionsDelta& Delta);
 
 #pragma endregion
 